@@ -1,5 +1,6 @@
 #pragma once
 #include "../../helpers.hpp"
+#include "poly_approx.hpp"
 #include <cmath>
 #include <algorithm>
 #include <cstddef>
@@ -24,21 +25,25 @@ namespace detail {
 // ========== SIGMOID ==========
 // Sigmoid: 1/(1 + e^-x)
 // Input and output use same Q format
-template<int Xb>
+// Evaluated as (1 + tanh(x/2)) / 2 with the piecewise tanh kernel
+// (poly_approx.hpp): no exp, no divide
+template<int Xb, typename Acc = precise>
 inline Storage_t<Xb>
 reference_sigmoid(Storage_t<Xb> ax, int frac_bits)
 {
-    // Convert fixed-point to float
-    float scale = static_cast<float>(1u << frac_bits);
-    float x = static_cast<float>(ax) / scale;
-
-    // Compute sigmoid: 1/(1 + e^-x)
-    float result = 1.0f / (1.0f + std::exp(-x));
-
-    // Convert back to fixed-point with same Q format
-    long long result_scaled = llroundf(result * scale);
+    int64_t s = sigmoid_q31<Acc>(ax, frac_bits);   // Q31, [0, 1]
+    return sat_cast<Storage_t<Xb>>(round_shift(s, 31 - frac_bits));
+}
 
-    return sat_cast<Storage_t<Xb>>(result_scaled);
+// Element-wise sigmoid (out-of-place, same Q format)
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_sigmoid(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                        size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_sigmoid<Xb, Acc>(input[i], frac_bits);
+    }
 }
 
 // ========== RELU ==========
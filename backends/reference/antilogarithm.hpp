@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
-#include <cmath>
+#include <cstddef>
+#include "poly_approx.hpp"
 #include <limits>
 
 namespace fp {
@@ -19,94 +20,106 @@ namespace detail {
 //   - Returns 0 on underflow
 //
 // This means:
-//   - Input value range: approximately [-32, 32) with high precision
-//   - Output value range: approximately [-32768, 32768)
+//   - Input value range: approximately [-64, 64) with high precision
+//   - Output value range: approximately [0, 65536)
 //
-// Implementation uses floating-point exponential functions and converts
-// the result to Q16.15 fixed-point format.
+// Implementation (integer only, see poly_approx.hpp):
+//   1. Scale the exponent to base 2 (by log2(e) or log2(10)) in Q30
+//   2. Split it into integer n and fraction f, 2^f = P(f) by accuracy tier
+//   3. Shift by n into Q16.15 with saturation
 
-// Base-2 antilogarithm (2^x)
-// Input: Any Q format (interpreted as Q6.25), output: Q16.15
-template<int Xb>
+// Shared tail: 2^x for a Q30 exponent, saturated to Q16.15
+template<typename Acc>
 inline int32_t
-reference_antilog2(Storage_t<Xb> ax, int frac_bits)
+antilog_q30_to_q15(int64_t x_q30)
 {
-    // Input is interpreted as Q6.25 regardless of actual format
-    // Convert input from Q6.25 to float
-    float x = static_cast<float>(ax) / static_cast<float>(1u << 25);
-
-    // Compute 2^x
-    float result = std::pow(2.0f, x);
-
-    // Convert result to Q16.15
-    float scale_q16_15 = static_cast<float>(1u << 15);
-    long long result_scaled = llroundf(result * scale_q16_15);
-
-    // Handle overflow/underflow
-    if (result_scaled > std::numeric_limits<int32_t>::max()) {
+    int64_t result = exp2_q30<Acc>(x_q30, 15);
+    if (result > std::numeric_limits<int32_t>::max()) {
         return std::numeric_limits<int32_t>::max();  // 0x7FFFFFFF
     }
-    if (result_scaled < 0) {
-        return 0;  // Underflow
-    }
+    return static_cast<int32_t>(result);
+}
 
-    return sat_cast<int32_t>(result_scaled);
+// Base-2 antilogarithm (2^x)
+// Input: Any Q format (interpreted as Q6.25), output: Q16.15
+template<int Xb, typename Acc = precise>
+inline int32_t
+reference_antilog2(Storage_t<Xb> ax, int frac_bits)
+{
+    // Q6.25 -> Q30
+    int64_t x_q30 = static_cast<int64_t>(ax) * 32;
+    return antilog_q30_to_q15<Acc>(x_q30);
 }
 
-// Natural antilogarithm (e^x)
+// Natural antilogarithm (e^x = 2^(x*log2(e)))
 // Input: Any Q format (interpreted as Q6.25), output: Q16.15
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline int32_t
 reference_antilogn(Storage_t<Xb> ax, int frac_bits)
 {
-    // Input is interpreted as Q6.25 regardless of actual format
-    // Convert input from Q6.25 to float
-    float x = static_cast<float>(ax) / static_cast<float>(1u << 25);
-
-    // Compute e^x
-    float result = std::exp(x);
-
-    // Convert result to Q16.15
-    float scale_q16_15 = static_cast<float>(1u << 15);
-    long long result_scaled = llroundf(result * scale_q16_15);
-
-    // Handle overflow/underflow
-    if (result_scaled > std::numeric_limits<int32_t>::max()) {
-        return std::numeric_limits<int32_t>::max();  // 0x7FFFFFFF
-    }
-    if (result_scaled < 0) {
-        return 0;  // Underflow
-    }
-
-    return sat_cast<int32_t>(result_scaled);
+    int64_t x_q30 = static_cast<int64_t>(ax) * 32;
+    return antilog_q30_to_q15<Acc>(mul_q30(x_q30, Q30_LOG2E));
 }
 
-// Base-10 antilogarithm (10^x)
+// Base-10 antilogarithm (10^x = 2^(x*log2(10)))
 // Input: Any Q format (interpreted as Q6.25), output: Q16.15
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline int32_t
 reference_antilog10(Storage_t<Xb> ax, int frac_bits)
 {
-    // Input is interpreted as Q6.25 regardless of actual format
-    // Convert input from Q6.25 to float
-    float x = static_cast<float>(ax) / static_cast<float>(1u << 25);
+    int64_t x_q30 = static_cast<int64_t>(ax) * 32;
+    return antilog_q30_to_q15<Acc>(mul_q30(x_q30, Q30_LOG2_10));
+}
 
-    // Compute 10^x
-    float result = std::pow(10.0f, x);
+// Base-2 antilogarithm between arbitrary Q formats (used by fp::LogFixed)
+// Input: in_frac_bits fractional bits, output: out_frac_bits, saturated to Ob
+// Returns the Ob maximum on overflow and 0 on underflow
+template<int Xb, int Ob, typename Acc = precise>
+inline Storage_t<Ob>
+reference_exp2_q(Storage_t<Xb> ax, int in_frac_bits, int out_frac_bits)
+{
+    using Out = Storage_t<Ob>;
+    int64_t result = exp2_q30<Acc>(to_q30(ax, in_frac_bits), out_frac_bits);
+    if (result > std::numeric_limits<Out>::max()) {
+        return std::numeric_limits<Out>::max();
+    }
+    return static_cast<Out>(result);
+}
 
-    // Convert result to Q16.15
-    float scale_q16_15 = static_cast<float>(1u << 15);
-    long long result_scaled = llroundf(result * scale_q16_15);
+// ========== ARRAY VERSIONS ==========
+// Input interpreted as Q6.25, output Q16.15 (saturating)
 
-    // Handle overflow/underflow
-    if (result_scaled > std::numeric_limits<int32_t>::max()) {
-        return std::numeric_limits<int32_t>::max();  // 0x7FFFFFFF
+// Element-wise antilog2: Q16.15 output
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_antilog2(const Storage_t<Xb>* input, int32_t* output,
+                         size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_antilog2<Xb, Acc>(input[i], frac_bits);
     }
-    if (result_scaled < 0) {
-        return 0;  // Underflow
+}
+
+// Element-wise antilogn: Q16.15 output
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_antilogn(const Storage_t<Xb>* input, int32_t* output,
+                         size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_antilogn<Xb, Acc>(input[i], frac_bits);
     }
+}
 
-    return sat_cast<int32_t>(result_scaled);
+// Element-wise antilog10: Q16.15 output
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_antilog10(const Storage_t<Xb>* input, int32_t* output,
+                          size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_antilog10<Xb, Acc>(input[i], frac_bits);
+    }
 }
 
 } // namespace detail
@@ -15,9 +15,19 @@
 #include "activation.hpp"
 #include "vector_ops.hpp"
 #include "vector_scale.hpp"
+#include "vector_convert.hpp"
+#include "vector_interleave.hpp"
+#include "vector_mixed.hpp"
+#include "vector_blas.hpp"
+#include "vector_poly.hpp"
+#include "vector_float.hpp"
 #include "vector_minmax.hpp"
 #include "vector_elemwise.hpp"
 #include "vector_stats.hpp"
+#include "vector_strided.hpp"
+#include "vector_static.hpp"
+#include "vector_batch.hpp"
+#include "vector_parallel.hpp"
 
 namespace fp {
 
@@ -52,63 +62,170 @@ struct ReferenceBackend {
         return detail::reference_div<Xb, Yb, Ob>(ax, by, out_frac_shift);
     }
 
-    // Logarithm operations (input converted to Q16.15, output as Q6.25)
-    template<int Xb>
+    // Logarithm operations (output as Q6.25)
+    // Transcendental operations take an accuracy tier (fp::fast, fp::balanced,
+    // fp::precise) selecting the polynomial degree, see poly_approx.hpp
+    template<int Xb, typename Acc = precise>
     static int32_t log2(typename StorageForBits<Xb>::type ax, int frac_bits) {
-        return detail::reference_log2<Xb>(ax, frac_bits);
+        return detail::reference_log2<Xb, Acc>(ax, frac_bits);
     }
 
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static int32_t logn(typename StorageForBits<Xb>::type ax, int frac_bits) {
-        return detail::reference_logn<Xb>(ax, frac_bits);
+        return detail::reference_logn<Xb, Acc>(ax, frac_bits);
     }
 
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static int32_t log10(typename StorageForBits<Xb>::type ax, int frac_bits) {
-        return detail::reference_log10<Xb>(ax, frac_bits);
+        return detail::reference_log10<Xb, Acc>(ax, frac_bits);
     }
 
     // Antilogarithm operations (input as Q6.25, output as Q16.15)
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static int32_t antilog2(Storage_t<Xb> ax, int frac_bits) {
-        return detail::reference_antilog2<Xb>(ax, frac_bits);
+        return detail::reference_antilog2<Xb, Acc>(ax, frac_bits);
     }
 
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static int32_t antilogn(Storage_t<Xb> ax, int frac_bits) {
-        return detail::reference_antilogn<Xb>(ax, frac_bits);
+        return detail::reference_antilogn<Xb, Acc>(ax, frac_bits);
     }
 
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static int32_t antilog10(Storage_t<Xb> ax, int frac_bits) {
-        return detail::reference_antilog10<Xb>(ax, frac_bits);
+        return detail::reference_antilog10<Xb, Acc>(ax, frac_bits);
+    }
+
+    // log2 / 2^x between arbitrary Q formats (log-domain conversions)
+    template<int Xb, int Ob, typename Acc = precise>
+    static Storage_t<Ob> log2_q(Storage_t<Xb> ax, int in_frac_bits, int out_frac_bits) {
+        return detail::reference_log2_q<Xb, Ob, Acc>(ax, in_frac_bits, out_frac_bits);
+    }
+
+    template<int Xb, int Ob, typename Acc = precise>
+    static Storage_t<Ob> exp2_q(Storage_t<Xb> ax, int in_frac_bits, int out_frac_bits) {
+        return detail::reference_exp2_q<Xb, Ob, Acc>(ax, in_frac_bits, out_frac_bits);
     }
 
     // Power operation
-    template<int Xb, int Yb>
+    template<int Xb, int Yb, typename Acc = precise>
     static typename StorageForBits<Xb>::type
     pow(typename StorageForBits<Xb>::type base,
         typename StorageForBits<Yb>::type exponent,
         int base_frac_bits,
         int exp_frac_bits)
     {
-        return detail::reference_pow<Xb, Yb>(base, exponent, base_frac_bits, exp_frac_bits);
+        return detail::reference_pow<Xb, Yb, Acc>(base, exponent, base_frac_bits, exp_frac_bits);
     }
 
     // Square root operation (returns same Q format as input)
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static typename StorageForBits<Xb>::type
     sqrt(typename StorageForBits<Xb>::type ax, int frac_bits)
     {
-        return detail::reference_sqrt<Xb>(ax, frac_bits);
+        return detail::reference_sqrt<Xb, Acc>(ax, frac_bits);
     }
 
     // Reciprocal square root operation (returns same Q format as input)
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static typename StorageForBits<Xb>::type
     rsqrt(typename StorageForBits<Xb>::type ax, int frac_bits)
     {
-        return detail::reference_rsqrt<Xb>(ax, frac_bits);
+        return detail::reference_rsqrt<Xb, Acc>(ax, frac_bits);
+    }
+
+    // Array square root / reciprocal square root (out-of-place, same Q format)
+    template<int Xb, typename Acc = precise>
+    static void
+    array_sqrt(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+               size_t length, int frac_bits)
+    {
+        detail::reference_array_sqrt<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_rsqrt(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                size_t length, int frac_bits)
+    {
+        detail::reference_array_rsqrt<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    // Element-wise logarithms (output Q6.25) and antilogarithms (input Q6.25,
+    // output Q16.15)
+    template<int Xb, typename Acc = precise>
+    static void
+    array_log2(const Storage_t<Xb>* input, int32_t* output,
+               size_t length, int frac_bits)
+    {
+        detail::reference_array_log2<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_logn(const Storage_t<Xb>* input, int32_t* output,
+               size_t length, int frac_bits)
+    {
+        detail::reference_array_logn<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_log10(const Storage_t<Xb>* input, int32_t* output,
+                size_t length, int frac_bits)
+    {
+        detail::reference_array_log10<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_antilog2(const Storage_t<Xb>* input, int32_t* output,
+                   size_t length, int frac_bits)
+    {
+        detail::reference_array_antilog2<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_antilogn(const Storage_t<Xb>* input, int32_t* output,
+                   size_t length, int frac_bits)
+    {
+        detail::reference_array_antilogn<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_antilog10(const Storage_t<Xb>* input, int32_t* output,
+                    size_t length, int frac_bits)
+    {
+        detail::reference_array_antilog10<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    // Element-wise power with a shared exponent (base Q format)
+    template<int Xb, int Yb, typename Acc = precise>
+    static void
+    array_pow(const Storage_t<Xb>* base, Storage_t<Xb>* output, size_t length,
+              Storage_t<Yb> exponent, int base_frac_bits, int exp_frac_bits)
+    {
+        detail::reference_array_pow<Xb, Yb, Acc>(base, output, length, exponent,
+                                                 base_frac_bits, exp_frac_bits);
+    }
+
+    // Element-wise reciprocal (same Q format)
+    template<int Xb>
+    static void
+    array_recip(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                size_t length, int frac_bits)
+    {
+        detail::reference_array_recip<Xb>(input, output, length, frac_bits);
+    }
+
+    // Wide-input square root (64-bit accumulator in, Ob-bit storage out)
+    template<int Ob>
+    static Storage_t<Ob>
+    sqrt64(int64_t x, int in_frac_bits, int out_frac_bits)
+    {
+        return detail::reference_sqrt64<Ob>(x, in_frac_bits, out_frac_bits);
     }
 
     // Array Shift/Scale operations (in-place)
@@ -127,6 +244,58 @@ struct ReferenceBackend {
         detail::reference_array_scale<Xb>(arr, length, scale_factor, scale_frac_bits);
     }
 
+    // Q-format conversion (out-of-place): out = sat(round(in * 2^Shift)),
+    // Shift = output frac bits - input frac bits
+    template<int Xb, int Yb, int Shift>
+    static void
+    array_convert(const Storage_t<Xb>* in, Storage_t<Yb>* out, size_t length)
+    {
+        detail::reference_array_convert<Xb, Yb, Shift>(in, out, length);
+    }
+
+    // Interleaved <-> planar with the same conversion: frame f of channel c
+    // at interleaved[f * stride + c] (channels <= stride), planes[c][f]
+    template<int Xb, int Yb, int Shift>
+    static void
+    array_deinterleave(const Storage_t<Xb>* in, size_t stride, Storage_t<Yb>* const* planes,
+                       size_t channels, size_t frames)
+    {
+        detail::reference_array_deinterleave<Xb, Yb, Shift>(in, stride, planes, channels, frames);
+    }
+
+    template<int Xb, int Yb, int Shift>
+    static void
+    array_interleave(const Storage_t<Xb>* const* planes, Storage_t<Yb>* out, size_t stride,
+                     size_t channels, size_t frames)
+    {
+        detail::reference_array_interleave<Xb, Yb, Shift>(planes, out, stride, channels, frames);
+    }
+
+    // Converting copy between two rows x cols layouts (MatrixView strides),
+    // e.g. an AoS <-> SoA block transpose
+    template<int Xb, int Yb, int Shift>
+    static void
+    matrix_convert(const Storage_t<Xb>* in, ptrdiff_t in_rs, ptrdiff_t in_cs,
+                   Storage_t<Yb>* out, ptrdiff_t out_rs, ptrdiff_t out_cs, size_t rows, size_t cols)
+    {
+        detail::reference_matrix_convert<Xb, Yb, Shift>(in, in_rs, in_cs, out, out_rs, out_cs, rows, cols);
+    }
+
+    // Bulk float conversion: same values as FixedPoint(float) / to_float()
+    template<int Xb>
+    static void
+    array_from_float(const float* in, Storage_t<Xb>* out, size_t length, int frac_bits)
+    {
+        detail::reference_array_from_float<Xb>(in, out, length, frac_bits);
+    }
+
+    template<int Xb>
+    static void
+    array_to_float(const Storage_t<Xb>* in, float* out, size_t length, int frac_bits)
+    {
+        detail::reference_array_to_float<Xb>(in, out, length, frac_bits);
+    }
+
     // Array Min/Max operations
     template<int Xb>
     static Storage_t<Xb>
@@ -142,6 +311,86 @@ struct ReferenceBackend {
         return detail::reference_array_max<Xb>(arr, length);
     }
 
+    // Element-wise min/max/abs/clip/select
+    template<int Xb>
+    static void
+    array_elemax(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                 Storage_t<Xb>* output, size_t length)
+    {
+        detail::reference_array_elemax<Xb>(arr1, arr2, output, length);
+    }
+
+    template<int Xb>
+    static void
+    array_elemin(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                 Storage_t<Xb>* output, size_t length)
+    {
+        detail::reference_array_elemin<Xb>(arr1, arr2, output, length);
+    }
+
+    template<int Xb>
+    static void
+    array_abs(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length)
+    {
+        detail::reference_array_abs<Xb>(input, output, length);
+    }
+
+    template<int Xb>
+    static void
+    array_clip(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length,
+               Storage_t<Xb> lo, Storage_t<Xb> hi)
+    {
+        detail::reference_array_clip<Xb>(input, output, length, lo, hi);
+    }
+
+    template<int Xb>
+    static void
+    array_threshold(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length,
+                    Storage_t<Xb> threshold, Storage_t<Xb> value)
+    {
+        detail::reference_array_threshold<Xb>(input, output, length, threshold, value);
+    }
+
+    template<int Xb>
+    static void
+    array_select(const Storage_t<Xb>* input, const Storage_t<Xb>* above,
+                 const Storage_t<Xb>* below, Storage_t<Xb>* output, size_t length,
+                 Storage_t<Xb> threshold)
+    {
+        detail::reference_array_select<Xb>(input, above, below, output, length, threshold);
+    }
+
+    // Index search: argmin/argmax, top-k, peak picking
+    template<int Xb>
+    static size_t
+    array_argmin(const Storage_t<Xb>* arr, size_t length, Storage_t<Xb>& value)
+    {
+        return detail::reference_array_argmin<Xb>(arr, length, value);
+    }
+
+    template<int Xb>
+    static size_t
+    array_argmax(const Storage_t<Xb>* arr, size_t length, Storage_t<Xb>& value)
+    {
+        return detail::reference_array_argmax<Xb>(arr, length, value);
+    }
+
+    template<int Xb>
+    static size_t
+    array_top_k(const Storage_t<Xb>* arr, size_t length,
+                Storage_t<Xb>* values, size_t* indices, size_t k)
+    {
+        return detail::reference_array_top_k<Xb>(arr, length, values, indices, k);
+    }
+
+    template<int Xb>
+    static size_t
+    array_find_peaks(const Storage_t<Xb>* arr, size_t length, Storage_t<Xb> threshold,
+                     size_t* indices, size_t max_peaks)
+    {
+        return detail::reference_array_find_peaks<Xb>(arr, length, threshold, indices, max_peaks);
+    }
+
     // Vector operations
     template<int Xb>
     static Storage_t<Xb>
@@ -150,6 +399,15 @@ struct ReferenceBackend {
         return detail::reference_dot_product<Xb>(arr1, arr2, length, frac_bits);
     }
 
+    // Mixed-precision dot product (e.g. 32-bit data, 16-bit taps): exact
+    // sum, rounded once by shift = Fx + Fy - Fout (negative: left, saturating)
+    template<int Xb, int Yb, int Ob>
+    static Storage_t<Ob>
+    dot_product_mixed(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2, size_t length, int shift)
+    {
+        return detail::reference_dot_product_mixed<Xb, Yb, Ob>(arr1, arr2, length, shift);
+    }
+
     template<int Xb>
     static Storage_t<Xb>
     array_sum(const Storage_t<Xb>* arr, size_t length)
@@ -157,49 +415,146 @@ struct ReferenceBackend {
         return detail::reference_array_sum<Xb>(arr, length);
     }
 
-    // Trigonometric operations
     template<int Xb>
     static Storage_t<Xb>
+    array_power(const Storage_t<Xb>* arr, size_t length, int frac_bits)
+    {
+        return detail::reference_array_power<Xb>(arr, length, frac_bits);
+    }
+
+    // BLAS level-1 with independent Q formats; product shifts are
+    // Fscalar + Fin - Fout, as FixedPoint::mul<OI, OF>
+    template<int Ab, int Xb, int Yb, int Shift>
+    static void
+    array_axpy(Storage_t<Ab> alpha, const Storage_t<Xb>* x, Storage_t<Yb>* y, size_t length)
+    {
+        detail::reference_array_axpy<Ab, Xb, Yb, Shift>(alpha, x, y, length);
+    }
+
+    template<int Ab, int Xb, int Bb, int Yb, int ShiftA, int ShiftB>
+    static void
+    array_axpby(Storage_t<Ab> alpha, const Storage_t<Xb>* x, Storage_t<Bb> beta, Storage_t<Yb>* y,
+                size_t length)
+    {
+        detail::reference_array_axpby<Ab, Xb, Bb, Yb, ShiftA, ShiftB>(alpha, x, beta, y, length);
+    }
+
+    template<int Xb, int Ab, int Shift>
+    static void
+    array_scale_mixed(Storage_t<Xb>* arr, size_t length, Storage_t<Ab> alpha)
+    {
+        detail::reference_array_scale_mixed<Xb, Ab, Shift>(arr, length, alpha);
+    }
+
+    // sum(|x|), rounded by shift = Fx - Fout (negative: left, saturating)
+    template<int Xb, int Ob>
+    static Storage_t<Ob>
+    array_asum(const Storage_t<Xb>* arr, size_t length, int shift)
+    {
+        return detail::reference_array_asum<Xb, Ob>(arr, length, shift);
+    }
+
+    // sqrt(sum(x^2)) with out_frac fractional bits
+    template<int Xb, int Ob>
+    static Storage_t<Ob>
+    array_nrm2(const Storage_t<Xb>* arr, size_t length, int frac_bits, int out_frac)
+    {
+        return detail::reference_array_nrm2<Xb, Ob>(arr, length, frac_bits, out_frac);
+    }
+
+    // Polynomial c0 + c1 x + ... with compile-time coefficients (CF fractional
+    // bits), x with F and the output with OF fractional bits
+    template<int Xb, int Ob, int F, int OF, int CF, int64_t... C>
+    static void
+    array_poly(const Storage_t<Xb>* x, Storage_t<Ob>* output, size_t length)
+    {
+        detail::reference_array_poly<Xb, Ob, F, OF, CF, C...>(x, output, length);
+    }
+
+    // Trigonometric operations
+    template<int Xb, typename Acc = precise>
+    static Storage_t<Xb>
     sin(Storage_t<Xb> ax, int frac_bits)
     {
-        return detail::reference_sin<Xb>(ax, frac_bits);
+        return detail::reference_sin<Xb, Acc>(ax, frac_bits);
     }
 
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static Storage_t<Xb>
     cos(Storage_t<Xb> ax, int frac_bits)
     {
-        return detail::reference_cos<Xb>(ax, frac_bits);
+        return detail::reference_cos<Xb, Acc>(ax, frac_bits);
     }
 
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static Storage_t<Xb>
     tan(Storage_t<Xb> ax, int frac_bits)
     {
-        return detail::reference_tan<Xb>(ax, frac_bits);
+        return detail::reference_tan<Xb, Acc>(ax, frac_bits);
     }
 
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static Storage_t<Xb>
     atan(Storage_t<Xb> ax, int frac_bits)
     {
-        return detail::reference_atan<Xb>(ax, frac_bits);
+        return detail::reference_atan<Xb, Acc>(ax, frac_bits);
+    }
+
+    // Element-wise trigonometric functions (same Q format)
+    template<int Xb, typename Acc = precise>
+    static void
+    array_sin(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+              size_t length, int frac_bits)
+    {
+        detail::reference_array_sin<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_cos(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+              size_t length, int frac_bits)
+    {
+        detail::reference_array_cos<Xb, Acc>(input, output, length, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_atan(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+               size_t length, int frac_bits)
+    {
+        detail::reference_array_atan<Xb, Acc>(input, output, length, frac_bits);
     }
 
     // Hyperbolic functions
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static Storage_t<Xb>
     tanh(Storage_t<Xb> ax, int frac_bits)
     {
-        return detail::reference_tanh<Xb>(ax, frac_bits);
+        return detail::reference_tanh<Xb, Acc>(ax, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_tanh(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+               size_t length, int frac_bits)
+    {
+        detail::reference_array_tanh<Xb, Acc>(input, output, length, frac_bits);
     }
 
     // Activation functions
-    template<int Xb>
+    template<int Xb, typename Acc = precise>
     static Storage_t<Xb>
     sigmoid(Storage_t<Xb> ax, int frac_bits)
     {
-        return detail::reference_sigmoid<Xb>(ax, frac_bits);
+        return detail::reference_sigmoid<Xb, Acc>(ax, frac_bits);
+    }
+
+    template<int Xb, typename Acc = precise>
+    static void
+    array_sigmoid(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                  size_t length, int frac_bits)
+    {
+        detail::reference_array_sigmoid<Xb, Acc>(input, output, length, frac_bits);
     }
 
     template<int Xb>
@@ -242,6 +597,144 @@ struct ReferenceBackend {
         detail::reference_array_sub<Xb>(arr1, arr2, output, length);
     }
 
+    // Mixed-format element-wise ops: inputs and output in independent Q
+    // formats, alignment and rounding fused into the loop. Shifts are right
+    // shifts (negative: left), as in the scalar mul / add / sub<OI, OF>
+    template<int Xb, int Yb, int Ob, int Shift>
+    static void
+    array_elemult_mixed(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2,
+                        Storage_t<Ob>* output, size_t length)
+    {
+        detail::reference_array_elemult_mixed<Xb, Yb, Ob, Shift>(arr1, arr2, output, length);
+    }
+
+    template<int Xb, int Yb, int Ob, int ShiftA, int ShiftB>
+    static void
+    array_add_mixed(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2,
+                    Storage_t<Ob>* output, size_t length)
+    {
+        detail::reference_array_addsub_mixed<Xb, Yb, Ob, ShiftA, ShiftB, false>(arr1, arr2, output, length);
+    }
+
+    template<int Xb, int Yb, int Ob, int ShiftA, int ShiftB>
+    static void
+    array_sub_mixed(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2,
+                    Storage_t<Ob>* output, size_t length)
+    {
+        detail::reference_array_addsub_mixed<Xb, Yb, Ob, ShiftA, ShiftB, true>(arr1, arr2, output, length);
+    }
+
+    // Layout-tagged overloads (AlignedArray): the guaranteed alignment and
+    // length multiple are passed on to the optimizer, so host loops need no
+    // peeling or remainder handling
+    template<int Xb, size_t Align, size_t Mult>
+    static void
+    array_elemult(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                  Storage_t<Xb>* output, size_t length, int frac_bits, Layout<Align, Mult>)
+    {
+        detail::reference_array_elemult<Xb>(assume_aligned<Align>(arr1), assume_aligned<Align>(arr2),
+                                            assume_aligned<Align>(output),
+                                            Layout<Align, Mult>::blocks(length), frac_bits);
+    }
+
+    template<int Xb, size_t Align, size_t Mult>
+    static void
+    array_add(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+              Storage_t<Xb>* output, size_t length, Layout<Align, Mult>)
+    {
+        detail::reference_array_add<Xb>(assume_aligned<Align>(arr1), assume_aligned<Align>(arr2),
+                                        assume_aligned<Align>(output),
+                                        Layout<Align, Mult>::blocks(length));
+    }
+
+    template<int Xb, size_t Align, size_t Mult>
+    static void
+    array_sub(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+              Storage_t<Xb>* output, size_t length, Layout<Align, Mult>)
+    {
+        detail::reference_array_sub<Xb>(assume_aligned<Align>(arr1), assume_aligned<Align>(arr2),
+                                        assume_aligned<Align>(output),
+                                        Layout<Align, Mult>::blocks(length));
+    }
+
+    template<int Xb, size_t Align, size_t Mult>
+    static void
+    array_shift(Storage_t<Xb>* arr, size_t length, int shift_amount, Layout<Align, Mult>)
+    {
+        detail::reference_array_shift<Xb>(assume_aligned<Align>(arr),
+                                          Layout<Align, Mult>::blocks(length), shift_amount);
+    }
+
+    template<int Xb, size_t Align, size_t Mult>
+    static void
+    array_scale(Storage_t<Xb>* arr, size_t length, Storage_t<Xb> scale_factor, int scale_frac_bits,
+                Layout<Align, Mult>)
+    {
+        detail::reference_array_scale<Xb>(assume_aligned<Align>(arr), Layout<Align, Mult>::blocks(length),
+                                          scale_factor, scale_frac_bits);
+    }
+
+    template<int Xb, size_t Align, size_t Mult>
+    static Storage_t<Xb>
+    dot_product(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size_t length, int frac_bits,
+                Layout<Align, Mult>)
+    {
+        return detail::reference_dot_product<Xb>(assume_aligned<Align>(arr1), assume_aligned<Align>(arr2),
+                                                 Layout<Align, Mult>::blocks(length), frac_bits);
+    }
+
+    // Fixed-length kernels (FixedArray): N is a compile-time constant, the
+    // loops are expanded in blocks with no remainder path or length checks
+    template<int Xb, size_t N>
+    static void
+    static_elemult(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, Storage_t<Xb>* output, int frac_bits)
+    {
+        detail::reference_static_elemult<Xb, N>(arr1, arr2, output, frac_bits);
+    }
+
+    template<int Xb, size_t N>
+    static void
+    static_add(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, Storage_t<Xb>* output)
+    {
+        detail::reference_static_addsub<Xb, N, false>(arr1, arr2, output);
+    }
+
+    template<int Xb, size_t N>
+    static void
+    static_sub(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, Storage_t<Xb>* output)
+    {
+        detail::reference_static_addsub<Xb, N, true>(arr1, arr2, output);
+    }
+
+    template<int Xb, size_t N>
+    static Storage_t<Xb>
+    static_dot_product(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, int frac_bits)
+    {
+        return detail::reference_static_dot<Xb, N>(arr1, arr2, frac_bits);
+    }
+
+    template<int Xb, size_t N>
+    static void
+    static_shift(Storage_t<Xb>* arr, int shift_amount)
+    {
+        detail::reference_static_shift<Xb, N>(arr, shift_amount);
+    }
+
+    template<int Xb, size_t N>
+    static void
+    static_scale(Storage_t<Xb>* arr, Storage_t<Xb> scale_factor, int scale_frac_bits)
+    {
+        detail::reference_static_scale<Xb, N>(arr, scale_factor, scale_frac_bits);
+    }
+
+    // Fused evaluation of a lazy array expression into output
+    template<int Xb, typename Expr>
+    static void
+    array_eval(const Expr& expr, Storage_t<Xb>* output, size_t length)
+    {
+        detail::reference_array_eval<Xb>(expr, output, length);
+    }
+
     // Statistical vector operations
     template<int Xb>
     static Storage_t<Xb>
@@ -271,6 +764,123 @@ struct ReferenceBackend {
         return detail::reference_array_stddev<Xb>(arr, length, frac_bits);
     }
 
+    // Fused statistics: every field selected by Mask (fp::stat flags) in one pass
+    template<int Xb, unsigned Mask>
+    static detail::ArrayStatsRaw<Storage_t<Xb>>
+    array_stats(const Storage_t<Xb>* arr, size_t length, int frac_bits)
+    {
+        return detail::reference_array_stats<Xb, Mask>(arr, length, frac_bits);
+    }
+
+    // Strided views (StridedArray / MatrixView); strides are in elements
+    template<int Xb>
+    static void
+    strided_gather(const Storage_t<Xb>* src, ptrdiff_t stride, Storage_t<Xb>* dst, size_t length)
+    {
+        detail::reference_strided_gather<Xb>(src, stride, dst, length);
+    }
+
+    template<int Xb>
+    static void
+    strided_scatter(const Storage_t<Xb>* src, Storage_t<Xb>* dst, ptrdiff_t stride, size_t length)
+    {
+        detail::reference_strided_scatter<Xb>(src, dst, stride, length);
+    }
+
+    template<int Xb>
+    static void
+    strided_fill(Storage_t<Xb>* dst, ptrdiff_t stride, size_t length, Storage_t<Xb> value)
+    {
+        detail::reference_strided_fill<Xb>(dst, stride, length, value);
+    }
+
+    template<int Xb, typename Expr>
+    static void
+    strided_eval(const Expr& expr, Storage_t<Xb>* output, ptrdiff_t stride, size_t length)
+    {
+        detail::reference_strided_eval<Xb>(expr, output, stride, length);
+    }
+
+    template<int Xb, unsigned Mask>
+    static detail::ArrayStatsRaw<Storage_t<Xb>>
+    strided_stats(const Storage_t<Xb>* arr, ptrdiff_t stride, size_t length, int frac_bits)
+    {
+        return detail::reference_strided_stats<Xb, Mask>(arr, stride, length, frac_bits);
+    }
+
+    template<int Xb>
+    static Storage_t<Xb>
+    strided_dot(const Storage_t<Xb>* arr1, ptrdiff_t stride1,
+                const Storage_t<Xb>* arr2, ptrdiff_t stride2, size_t length, int frac_bits)
+    {
+        return detail::reference_strided_dot<Xb>(arr1, stride1, arr2, stride2, length, frac_bits);
+    }
+
+    template<int Xb>
+    static size_t
+    strided_argmin(const Storage_t<Xb>* arr, ptrdiff_t stride, size_t length, Storage_t<Xb>& value)
+    {
+        return detail::reference_strided_argext<Xb, false>(arr, stride, length, value);
+    }
+
+    template<int Xb>
+    static size_t
+    strided_argmax(const Storage_t<Xb>* arr, ptrdiff_t stride, size_t length, Storage_t<Xb>& value)
+    {
+        return detail::reference_strided_argext<Xb, true>(arr, stride, length, value);
+    }
+
+    // Batched small vectors (BatchView): count vectors of the given length,
+    // element j of vector k at data[j * ld + k]; one result per vector
+    template<int Xb>
+    static void
+    batch_dot(const Storage_t<Xb>* a, size_t lda, const Storage_t<Xb>* b, size_t ldb,
+              size_t count, size_t length, Storage_t<Xb>* output, int frac_bits)
+    {
+        detail::reference_batch_dot<Xb>(a, lda, b, ldb, count, length, output, frac_bits);
+    }
+
+    template<int Xb>
+    static void
+    batch_power(const Storage_t<Xb>* x, size_t ld, size_t count, size_t length,
+                Storage_t<Xb>* output, int frac_bits)
+    {
+        detail::reference_batch_power<Xb>(x, ld, count, length, output, frac_bits);
+    }
+
+    template<int Xb>
+    static void
+    batch_norm(const Storage_t<Xb>* x, size_t ld, size_t count, size_t length,
+               Storage_t<Xb>* output, int frac_bits)
+    {
+        detail::reference_batch_norm<Xb>(x, ld, count, length, output, frac_bits);
+    }
+
+    template<int Xb>
+    static void
+    batch_axpy(const Storage_t<Xb>* alpha, const Storage_t<Xb>* x, size_t ldx,
+               Storage_t<Xb>* y, size_t ldy, size_t count, size_t length, int frac_bits)
+    {
+        detail::reference_batch_axpy<Xb>(alpha, x, ldx, y, ldy, count, length, frac_bits);
+    }
+
+    // Parallel reductions (parallel_policy): chunked over a thread pool,
+    // bit-identical to dot_product / array_stats
+    template<int Xb>
+    static Storage_t<Xb>
+    parallel_dot_product(const parallel_policy& policy, const Storage_t<Xb>* arr1,
+                         const Storage_t<Xb>* arr2, size_t length, int frac_bits)
+    {
+        return detail::reference_parallel_dot<Xb>(policy, arr1, arr2, length, frac_bits);
+    }
+
+    template<int Xb, unsigned Mask>
+    static detail::ArrayStatsRaw<Storage_t<Xb>>
+    parallel_array_stats(const parallel_policy& policy, const Storage_t<Xb>* arr, size_t length, int frac_bits)
+    {
+        return detail::reference_parallel_stats<Xb, Mask>(policy, arr, length, frac_bits);
+    }
+
     // Future operations will be added here as methods that forward to
     // implementations in their respective category header files
 };
@@ -1,5 +1,6 @@
 #pragma once
 #include "../../helpers.hpp"
+#include <cstddef>
 
 namespace fp {
 struct ReferenceBackend;
@@ -76,5 +77,36 @@ reference_div( typename StorageForBits<Xb>::type ax,
     return sat_cast<Out>(quotient);
 }
 
+// ========== RECIPROCAL ==========
+
+// Reciprocal 1/x in the same Q format, rounded to nearest and saturated
+// Division by zero saturates to max
+template<int Xb>
+inline Storage_t<Xb>
+reference_recip(Storage_t<Xb> ax, int frac_bits)
+{
+    using Out = Storage_t<Xb>;
+    if (ax == 0) {
+        return std::numeric_limits<Out>::max();
+    }
+
+    // 2^(2F) / x keeps F fractional bits; 2F <= 62 fits in 64 bits
+    long long one_sq = 1ll << (2 * frac_bits);
+    long long x = ax;
+    long long q = (x > 0) ? (one_sq + x / 2) / x : -((one_sq - x / 2) / -x);
+    return sat_cast<Out>(q);
+}
+
+// Element-wise reciprocal (out-of-place, same Q format)
+template<int Xb>
+inline void
+reference_array_recip(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                      size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_recip<Xb>(input[i], frac_bits);
+    }
+}
+
 } // namespace detail
 } // namespace fp
@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
-#include <cmath>
+#include "poly_approx.hpp"
+#include <cstddef>
 
 namespace fp {
 namespace detail {
@@ -9,25 +10,29 @@ namespace detail {
 // Reference Hyperbolic Implementation
 // ============================================================================
 //
-// Hyperbolic functions using standard C++ math library.
+// Hyperbolic functions using the piecewise polynomial kernel of poly_approx.hpp.
 // Input is treated as a value in the input Q format.
 // Output maintains the same Q format as input.
 
 // Hyperbolic tangent function
-template<int Xb>
+// Piecewise polynomial on |x| with odd symmetry, saturates to +/-1
+template<int Xb, typename Acc = precise>
 inline Storage_t<Xb>
 reference_tanh(Storage_t<Xb> ax, int frac_bits)
 {
-    // Convert to float
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
-
-    // Compute hyperbolic tangent
-    float result = std::tanh(x);
-
-    // Convert back to fixed-point
-    long long result_scaled = llroundf(result * static_cast<float>(1u << frac_bits));
+    int64_t th = tanh_q30<Acc>(ax, frac_bits);   // Q30, [-1, 1]
+    return sat_cast<Storage_t<Xb>>(round_shift(th, 30 - frac_bits));
+}
 
-    return sat_cast<Storage_t<Xb>>(result_scaled);
+// Element-wise tanh (out-of-place, same Q format)
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_tanh(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                     size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_tanh<Xb, Acc>(input[i], frac_bits);
+    }
 }
 
 } // namespace detail
@@ -0,0 +1,137 @@
+#pragma once
+#include "../../helpers.hpp"
+#include <cstdint>
+#include <limits>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Integer Square Root Kernels
+// ============================================================================
+//
+// Float-free sqrt/rsqrt cores shared by the scalar, array and statistical
+// reference operations. They follow the same recipe as NatureDSP's
+// vec_sqrt/vec_rsqrt (which seed from polyrsqrtq23):
+//   1. Normalize the argument to a mantissa m in [0.25, 1) using an even
+//      shift, so that the exponent halves into an integer shift
+//   2. Seed 1/sqrt(m) from a table indexed by the top mantissa bits
+//   3. Refine with Newton iterations: y' = y * (3 - m*y^2) / 2
+//
+// The seed is accurate to ~2^-6 and Newton converges quadratically, so three
+// iterations reach the Q30 working precision. With the full three iterations
+// isqrt64_round() also corrects the last LSBs so its result is exactly
+// round(sqrt(n)). Fewer iterations (fp::fast / fp::balanced tiers, see
+// poly_approx.hpp) trade accuracy for speed: ~3.7e-4 after one, ~2e-7 after two.
+
+// 1/sqrt(x) at the midpoint of each bucket [k/64, (k+1)/64), k = 16..63, Q15
+inline constexpr uint16_t rsqrt_seed_q15[48] = {
+    64535, 62664, 60947, 59364, 57898, 56535, 55265, 54076,
+    52961, 51912, 50923, 49989, 49104, 48265, 47467, 46707,
+    45983, 45292, 44630, 43997, 43390, 42808, 42248, 41710,
+    41192, 40693, 40211, 39746, 39297, 38863, 38443, 38036,
+    37642, 37260, 36889, 36529, 36179, 35840, 35509, 35188,
+    34875, 34571, 34274, 33985, 33703, 33427, 33159, 32897,
+};
+
+// 1/sqrt(m) for a normalized mantissa m in [2^30, 2^32) (Q32, i.e. [0.25, 1))
+// Returns Q30 (value in (1, 2])
+inline uint32_t rsqrt_norm_q30(uint32_t m, int iterations = 3)
+{
+    uint64_t y = static_cast<uint64_t>(rsqrt_seed_q15[(m >> 26) - 16]) << 15;
+    for (int it = 0; it < iterations; ++it) {
+        uint64_t y2  = (y * y) >> 30;                          // Q30, (1, 4]
+        uint64_t my2 = (static_cast<uint64_t>(m) * y2) >> 32;  // Q30, ~1.0
+        uint64_t t   = (3ull << 30) - my2;                     // Q30, ~2.0
+        y = (y * t) >> 31;                                     // Q30, halved
+    }
+    return static_cast<uint32_t>(y);
+}
+
+// round(sqrt(n)) for 0 <= n < 2^63 (exact with 3 iterations)
+inline uint32_t isqrt64_round(uint64_t n, int iterations = 3)
+{
+    if (n == 0) return 0;
+
+    // n = (m / 2^32) * 2^(64 - nlz) with an even nlz
+    int nlz = count_leading_zeros64(n) & ~1;
+    uint32_t m = static_cast<uint32_t>((n << nlz) >> 32);
+
+    // sqrt(m) = m * rsqrt(m): Q32 * Q30 = Q62, then undo the normalization
+    int shift = 30 + nlz / 2;
+    uint64_t s = static_cast<uint64_t>(m) * rsqrt_norm_q30(m, iterations);
+    if (iterations < 3) {
+        return static_cast<uint32_t>((s + (1ull << (shift - 1))) >> shift);
+    }
+    s >>= shift;
+
+    // Truncating the mantissa leaves a few LSBs of error: fix up to floor(sqrt(n))
+    while (s * s > n) --s;
+    while ((s + 1) * (s + 1) <= n) ++s;
+
+    // Round to nearest: (s + 0.5)^2 = s^2 + s + 0.25
+    if (n - s * s > s) ++s;
+    return static_cast<uint32_t>(s);
+}
+
+// sqrt of a wide value x (in_frac fractional bits) into out_frac fractional bits
+// Computes round(sqrt(x * 2^(2*out_frac - in_frac))) with saturation to Out
+// Caller must reject negative input
+template<typename Out>
+inline Out
+isqrt_fixed(int64_t x, int in_frac, int out_frac, int iterations = 3)
+{
+    if (x <= 0) return 0;
+
+    int shift = 2 * out_frac - in_frac;
+    int post_shift = 0;
+
+    // Keep the shifted argument below 2^63; move the excess (rounded up to
+    // even) onto the result instead
+    if (shift > 0) {
+        int headroom = count_leading_zeros64(static_cast<uint64_t>(x)) - 1;
+        if (shift > headroom) {
+            post_shift = (shift - headroom + 1) / 2;
+            shift -= 2 * post_shift;
+        }
+    }
+
+    uint64_t n = (shift < 0) ? static_cast<uint64_t>(round_shift(x, -shift))
+                             : static_cast<uint64_t>(x) << shift;
+
+    long long r = static_cast<long long>(isqrt64_round(n, iterations));
+    if (post_shift > 0) {
+        if (post_shift >= 32) return std::numeric_limits<Out>::max();
+        r <<= post_shift;
+    }
+    return sat_cast<Out>(r);
+}
+
+// 1/sqrt of x (in_frac fractional bits) into out_frac fractional bits
+// Computes round(2^out_frac / sqrt(x / 2^in_frac)) with saturation to Out
+// Caller must reject non-positive input
+template<typename Out>
+inline Out
+irsqrt_fixed(int64_t x, int in_frac, int out_frac, int iterations = 3)
+{
+    uint64_t n = static_cast<uint64_t>(x);
+
+    // x / 2^in_frac = (m / 2^32) * 2^(2k); pick the normalization shift whose
+    // parity makes the exponent even (mantissa lands in [0.25, 0.5) or [0.5, 1))
+    int nlz = count_leading_zeros64(n);
+    nlz -= (nlz + in_frac) & 1;
+    uint32_t m = static_cast<uint32_t>((n << nlz) >> 32);
+    int k = (64 - nlz - in_frac) / 2;
+
+    // result = rsqrt(m) * 2^-k, rsqrt(m) is Q30
+    long long y = static_cast<long long>(rsqrt_norm_q30(m, iterations));
+    int shift = 30 + k - out_frac;
+    if (shift >= 0) {
+        return sat_cast<Out>(round_shift(y, shift));
+    }
+    if (-shift >= 32) return std::numeric_limits<Out>::max();
+    return sat_cast<Out>(y << (-shift));
+}
+
+} // namespace detail
+} // namespace fp
@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
-#include <cmath>
+#include <cstddef>
+#include "poly_approx.hpp"
 #include <limits>
 
 namespace fp {
@@ -13,114 +14,130 @@ namespace detail {
 // ============================================================================
 //
 // Logarithm functions follow NatureDSP conventions:
-//   - Input is interpreted as Q16.15 (regardless of actual format)
+//   - Input may be any Q format (frac_bits gives its scaling)
 //   - Output is in Q6.25 format
 //   - Returns 0x80000000 (most negative int32_t) on negative or zero input
 //
 // This means:
-//   - Input value range: approximately [-1.0, 1.0)
-//   - Output value range: approximately [-32, 32) with high precision
+//   - Output value range: approximately [-64, 64) with high precision
 //
-// Implementation uses floating-point logarithm functions and converts
-// the result to Q6.25 fixed-point format.
+// Implementation (integer only, see poly_approx.hpp):
+//   1. Normalize x = 2^e * (1 + t) with t in [0, 1)
+//   2. log2(x) = e - frac_bits + P(t), P selected by the accuracy tier
+//   3. logn/log10 scale the Q30 log2 by ln(2) / log10(2)
+//   4. Round Q30 to Q6.25
 
 // Base-2 logarithm (log2)
 // Input: Any Q format, output: Q6.25
-// The input is first converted to Q16.15 format as per NatureDSP convention
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline int32_t
 reference_log2(typename StorageForBits<Xb>::type ax, int frac_bits)
 {
-    // First convert input to Q16.15 format
-    // If input has more fractional bits than 15, shift right
-    // If input has fewer fractional bits than 15, shift left
-    int shift = frac_bits - 15;
-
-    int32_t input_q16_15;
-    if (shift > 0) {
-        // More fractional bits than Q16.15, shift right
-        input_q16_15 = static_cast<int32_t>(ax) >> shift;
-    } else if (shift < 0) {
-        // Fewer fractional bits than Q16.15, shift left
-        input_q16_15 = static_cast<int32_t>(ax) << (-shift);
-    } else {
-        input_q16_15 = static_cast<int32_t>(ax);
-    }
-
     // Check for negative or zero input
-    if (input_q16_15 <= 0) {
+    if (ax <= 0) {
         return std::numeric_limits<int32_t>::min();  // 0x80000000
     }
 
-    // Convert Q16.15 to float
-    float x = static_cast<float>(input_q16_15) / static_cast<float>(1u << 15);
-
-    // Compute log2(x)
-    float result = std::log2(x);
-
-    // Convert result to Q6.25
-    float scale_q6_25 = static_cast<float>(1u << 25);
-    long long result_scaled = llroundf(result * scale_q6_25);
+    int64_t result_q30 = log2_q30<Acc>(static_cast<uint64_t>(ax), frac_bits);
 
-    return sat_cast<int32_t>(result_scaled);
+    // Convert Q30 to Q6.25
+    return sat_cast<int32_t>(round_shift(result_q30, 5));
 }
 
 // Natural logarithm (logn / ln)
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline int32_t
 reference_logn(typename StorageForBits<Xb>::type ax, int frac_bits)
 {
-    int shift = frac_bits - 15;
-
-    int32_t input_q16_15;
-    if (shift > 0) {
-        input_q16_15 = static_cast<int32_t>(ax) >> shift;
-    } else if (shift < 0) {
-        input_q16_15 = static_cast<int32_t>(ax) << (-shift);
-    } else {
-        input_q16_15 = static_cast<int32_t>(ax);
-    }
-
-    if (input_q16_15 <= 0) {
+    if (ax <= 0) {
         return std::numeric_limits<int32_t>::min();
     }
 
-    float x = static_cast<float>(input_q16_15) / static_cast<float>(1u << 15);
-    float result = std::log(x);  // Natural logarithm
-
-    float scale_q6_25 = static_cast<float>(1u << 25);
-    long long result_scaled = llroundf(result * scale_q6_25);
+    int64_t log2_x = log2_q30<Acc>(static_cast<uint64_t>(ax), frac_bits);
+    int64_t result_q30 = mul_q30(log2_x, Q30_LN2);  // ln(x) = log2(x) * ln(2)
 
-    return sat_cast<int32_t>(result_scaled);
+    return sat_cast<int32_t>(round_shift(result_q30, 5));
 }
 
 // Base-10 logarithm (log10)
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline int32_t
 reference_log10(typename StorageForBits<Xb>::type ax, int frac_bits)
 {
-    int shift = frac_bits - 15;
-
-    int32_t input_q16_15;
-    if (shift > 0) {
-        input_q16_15 = static_cast<int32_t>(ax) >> shift;
-    } else if (shift < 0) {
-        input_q16_15 = static_cast<int32_t>(ax) << (-shift);
-    } else {
-        input_q16_15 = static_cast<int32_t>(ax);
+    if (ax <= 0) {
+        return std::numeric_limits<int32_t>::min();
     }
 
-    if (input_q16_15 <= 0) {
-        return std::numeric_limits<int32_t>::min();
+    int64_t log2_x = log2_q30<Acc>(static_cast<uint64_t>(ax), frac_bits);
+    int64_t result_q30 = mul_q30(log2_x, Q30_LOG10_2);  // log10(x) = log2(x) * log10(2)
+
+    return sat_cast<int32_t>(round_shift(result_q30, 5));
+}
+
+// Base-2 logarithm into an arbitrary Q format (used by fp::LogFixed)
+// Input: Any Q format, output: out_frac fractional bits, saturated to Ob
+// Returns the most negative Ob value on negative or zero input
+template<int Xb, int Ob, typename Acc = precise>
+inline Storage_t<Ob>
+reference_log2_q(Storage_t<Xb> ax, int in_frac_bits, int out_frac_bits)
+{
+    using Out = Storage_t<Ob>;
+    if (ax <= 0) {
+        return std::numeric_limits<Out>::min();
     }
 
-    float x = static_cast<float>(input_q16_15) / static_cast<float>(1u << 15);
-    float result = std::log10(x);
+    int64_t result_q30 = log2_q30<Acc>(static_cast<uint64_t>(ax), in_frac_bits);
+    return sat_cast<Out>(round_shift(result_q30, 30 - out_frac_bits));
+}
+
+// ========== ARRAY VERSIONS ==========
+// Input any Q format, output Q6.25 (INT32_MIN for non-positive elements)
+// Batched kernels (poly_approx.hpp), bit-identical to the scalar functions
+
+// Block driver: log2 in Q30, times Scale (Q30, 0 = none), rounded to Q6.25
+template<int Xb, typename Acc, int64_t Scale>
+inline void
+reference_array_log_blocks(const Storage_t<Xb>* input, int32_t* output,
+                           size_t length, int frac_bits)
+{
+    int64_t r[POLY_BLOCK];
+    for (size_t i0 = 0; i0 < length; i0 += POLY_BLOCK) {
+        size_t n = (length - i0 < POLY_BLOCK) ? (length - i0) : POLY_BLOCK;
+        log2_q30_block<Acc>(input + i0, r, n, frac_bits);
+        for (size_t i = 0; i < n; ++i) {
+            int64_t v = r[i];
+            if constexpr (Scale != 0) v = mul_q30(v, Scale);
+            int32_t y = sat_cast<int32_t>(round_shift(v, 5));
+            output[i0 + i] = (input[i0 + i] > 0) ? y : std::numeric_limits<int32_t>::min();
+        }
+    }
+}
 
-    float scale_q6_25 = static_cast<float>(1u << 25);
-    long long result_scaled = llroundf(result * scale_q6_25);
+// Element-wise log2: Q6.25 output
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_log2(const Storage_t<Xb>* input, int32_t* output,
+                     size_t length, int frac_bits)
+{
+    reference_array_log_blocks<Xb, Acc, 0>(input, output, length, frac_bits);
+}
+
+// Element-wise logn: Q6.25 output
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_logn(const Storage_t<Xb>* input, int32_t* output,
+                     size_t length, int frac_bits)
+{
+    reference_array_log_blocks<Xb, Acc, Q30_LN2>(input, output, length, frac_bits);
+}
 
-    return sat_cast<int32_t>(result_scaled);
+// Element-wise log10: Q6.25 output
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_log10(const Storage_t<Xb>* input, int32_t* output,
+                      size_t length, int frac_bits)
+{
+    reference_array_log_blocks<Xb, Acc, Q30_LOG10_2>(input, output, length, frac_bits);
 }
 
 } // namespace detail
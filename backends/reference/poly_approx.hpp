@@ -0,0 +1,375 @@
+#pragma once
+#include "../../helpers.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Integer Polynomial Kernels (Accuracy Tiers)
+// ============================================================================
+//
+// Float-free cores for the transcendental functions. Every kernel reduces
+// its argument to a small interval, evaluates a minimax polynomial with
+// Q30 coefficients by Horner's rule in 64-bit, and reconstructs the result.
+// The accuracy tier (fp::fast, fp::balanced, fp::precise) selects the
+// coefficient set, and with it the polynomial degree:
+//
+//   kernel        reduction                    fast      balanced   precise
+//   ------------  ---------------------------  --------  ---------  ---------
+//   log2(1+t)     t in [0,1), x = 2^e*(1+t)    deg 3     deg 6      deg 10
+//                 max abs error (log2 units)   7.7e-4    2.1e-6     4.3e-9
+//   2^f           f in [0,1), x = n + f        deg 3     deg 5      deg 7
+//                 max relative error           1.1e-4    1.1e-7     2.1e-9
+//   sin/cos       quarter turns, |t| <= 0.5    deg 3/4   deg 5/6    deg 9/10
+//                 max abs error                1.5e-4    5.7e-7     1.6e-9
+//   atan          |x|>1 -> 1/x, then t>tan(pi/8)
+//                 -> (t-1)/(t+1) (not in fast) deg 5     deg 7      deg 11
+//                 max abs error (radians)      6.1e-4    1.1e-7     1.9e-9
+//   tanh          odd symmetry, segments       5 x deg 4 18 x deg 6 22 x deg 8
+//                 saturates to 1 beyond        5         9          11
+//                 max abs error                9.1e-5    3.1e-8     3.2e-9
+//   sqrt/rsqrt    table seed + Newton steps    1 step    2 steps    3 + exact
+//                 max relative error           3.7e-4    2.0e-7     1 LSB
+//
+// Derived functions inherit these bounds: logn/log10 scale the log2 error by
+// ln(2)/log10(2), antilogn/antilog10 are bounded by the 2^f relative error,
+// sigmoid(x) = (1 + tanh(x/2)) / 2 by half the tanh error, tan by the sin/cos
+// error divided by |cos|, and pow(x, y) = 2^(y*log2(x)) by
+// |y|*ln(2)*log2_err + exp2_err (relative).
+// The precise tier is limited by Q30 working precision rather than degree.
+// All errors exclude the final rounding to the output Q format.
+
+template<typename Acc> struct PolyTier;
+
+template<> struct PolyTier<fast> {
+    // log2(1+t) = t * P(t)
+    static constexpr int32_t log2_coef[] = {1529645943, -632655614, 177579290};
+    // 2^f = P(f)
+    static constexpr int32_t exp2_coef[] = {1073626897, 747815430, 240881495, 85044899};
+    // sin(pi/2*t) = t * P(t^2), cos(pi/2*t) = P(t^2)
+    static constexpr int32_t sin_coef[]  = {1684996082, -667286378};
+    static constexpr int32_t cos_coef[]  = {1073731124, -1323902640, 264085772};
+    // atan(t) = t * P(t^2) over [-1, 1]
+    static constexpr int32_t atan_coef[] = {1068757446, -309978697, 85189577};
+    static constexpr bool atan_reduce   = false;
+    // tanh(x) on segments of width 1 up to 5: P_k(u), u in [0, 1) within segment k
+    static constexpr int     tanh_seg_bits = 0;
+    static constexpr int32_t tanh_coef[5][5] = {
+        {-7799, 1073494061, 9880411, -423073079, 157517506},
+        {817741877, 451737695, -351253242, 140736723, -23840658},
+        {1035123160, 75531085, -70395226, 37093179, -8925990},
+        {1068433023, 10535646, -10051166, 5452309, -1349098},
+        {1073021821, 1431733, -1370190, 746113, -185276},
+    };
+    static constexpr int  newton_iters  = 1;
+};
+
+template<> struct PolyTier<balanced> {
+    static constexpr int32_t log2_coef[] = {1548929644, -771249324, 492064469, -300151666,
+                                            132554911, -28408431};
+    static constexpr int32_t exp2_coef[] = {1073741709, 744269248, 257848051, 59985925,
+                                            9602290, 2036310};
+    static constexpr int32_t sin_coef[]  = {1686621276, -693327970, 83394729};
+    static constexpr int32_t cos_coef[]  = {1073741794, -1324672082, 272299471, -21913302};
+    // atan(t) = t * P(t^2) over [-tan(pi/8), tan(pi/8)]
+    static constexpr int32_t atan_coef[] = {1073739256, -357708170, 210249107, -115746267};
+    static constexpr bool atan_reduce   = true;
+    // tanh(x) on segments of width 1/2 up to 9: P_k(u), u in [0, 1) within segment k
+    static constexpr int     tanh_seg_bits = 1;
+    static constexpr int32_t tanh_coef[18][7] = {
+        {-19, 536872860, -33425, -44520150, -702713, 5680640, -1102663},
+        {496194542, 422218618, -97520361, -12873545, 11730598, -1956622, -37752},
+        {817755494, 225472432, -85865728, 13944160, 1755674, -1419383, 252893},
+        {971895535, 97016350, -43910459, 11807927, -1739408, 11760, 35029},
+        {1035116732, 37930387, -18283200, 5653338, -1205747, 169569, -12043},
+        {1059369036, 14276582, -7042577, 2283510, -537200, 91705, -9152},
+        {1068431906, 5296782, -2635193, 869101, -211263, 38109, -4085},
+        {1071785356, 1954682, -975517, 323731, -79616, 14633, -1604},
+        {1073021665, 719916, -359700, 119640, -29548, 5467, -604},
+        {1073476836, 264955, -132438, 44087, -10905, 2023, -224},
+        {1073644333, 97487, -48737, 16229, -4017, 746, -83},
+        {1073705958, 35865, -17931, 5972, -1478, 275, -30},
+        {1073728629, 13194, -6597, 2197, -544, 101, -11},
+        {1073736970, 4854, -2427, 808, -200, 37, -4},
+        {1073740038, 1786, -893, 297, -74, 14, -2},
+        {1073741167, 657, -328, 109, -27, 5, -1},
+        {1073741582, 242, -121, 40, -10, 2, 0},
+        {1073741735, 89, -44, 15, -4, 1, 0},
+    };
+    static constexpr int  newton_iters  = 2;
+};
+
+template<> struct PolyTier<precise> {
+    static constexpr int32_t log2_coef[] = {1549081811, -774530895, 516177141, -385599345,
+                                            300883629, -227580348, 150123932, -75665942,
+                                            24607780, -3755939};
+    static constexpr int32_t exp2_coef[] = {1073741824, 744261126, 257941086, 59598365,
+                                            10322424, 1442062, 153505, 23258};
+    static constexpr int32_t sin_coef[]  = {1686629713, -693598665, 85569234, -5026337, 169635};
+    static constexpr int32_t cos_coef[]  = {1073741824, -1324675879, 272375559, -22401978,
+                                            986942, -26684};
+    static constexpr int32_t atan_coef[] = {1073741820, -357913273, 214716401, -152730761,
+                                            112534528, -62682772};
+    static constexpr bool atan_reduce   = true;
+    // tanh(x) on segments of width 1/2 up to 11: P_k(u), u in [0, 1) within segment k
+    static constexpr int     tanh_seg_bits = 1;
+    static constexpr int32_t tanh_coef[22][9] = {
+        {0, 536870907, 168, -44741349, 13470, 4424450, 110259, -603117, 119732},
+        {496194519, 422220919, -97557978, -12641157, 11037973, -870716, -929401, 342099, -40760},
+        {817755498, 225472003, -85858952, 13904196, 1866900, -1575285, 355761, -20377, -4206},
+        {971895537, 97016139, -43907006, 11786617, -1675974, -87500, 116271, -30972, 3621},
+        {1035116732, 37930373, -18282969, 5651839, -1200985, 161417, -4415, -3636, 680},
+        {1059369036, 14276593, -7042746, 2284528, -540115, 95998, -12297, 919, -9},
+        {1068431906, 5296788, -2635297, 869733, -213105, 40896, -6238, 723, -50},
+        {1071785356, 1954685, -975562, 324001, -80405, 15833, -2541, 322, -25},
+        {1073021665, 719917, -359717, 119745, -29854, 5933, -969, 126, -10},
+        {1073476836, 264955, -132445, 44126, -11020, 2197, -361, 48, -4},
+        {1073644333, 97487, -48739, 16243, -4059, 810, -133, 18, -1},
+        {1073705958, 35865, -17932, 5977, -1494, 298, -49, 7, -1},
+        {1073728629, 13194, -6597, 2199, -550, 110, -18, 2, 0},
+        {1073736970, 4854, -2427, 809, -202, 40, -7, 1, 0},
+        {1073740038, 1786, -893, 298, -74, 15, -2, 0, 0},
+        {1073741167, 657, -328, 109, -27, 5, -1, 0, 0},
+        {1073741582, 242, -121, 40, -10, 2, 0, 0, 0},
+        {1073741735, 89, -44, 15, -4, 1, 0, 0, 0},
+        {1073741791, 33, -16, 5, -1, 0, 0, 0, 0},
+        {1073741812, 12, -6, 2, -1, 0, 0, 0, 0},
+        {1073741820, 4, -2, 1, 0, 0, 0, 0, 0},
+        {1073741822, 2, -1, 0, 0, 0, 0, 0, 0},
+    };
+    static constexpr int  newton_iters  = 3;
+};
+
+// Q30 constants
+constexpr int64_t Q30_ONE         = 1ll << 30;
+constexpr int64_t Q61_TWO_OVER_PI = 1467945251641000613;   // Q61: exact phase for large x
+constexpr int64_t Q30_PI_2        = 1686629713;
+constexpr int64_t Q30_PI_4        = 843314857;
+constexpr int64_t Q30_TAN_PI_8    = 444758426;
+constexpr int64_t Q30_LOG2E       = 1549082005;   // log2(e)
+constexpr int64_t Q30_LOG2_10     = 3566893132;   // log2(10)
+constexpr int64_t Q30_LN2         = 744261118;    // ln(2)
+constexpr int64_t Q30_LOG10_2     = 323228497;    // log10(2)
+
+// Horner evaluation of c[0] + c[1]*x + ... + c[N-1]*x^(N-1), all Q30
+template<size_t N>
+inline int64_t poly_q30(const int32_t (&c)[N], int64_t x)
+{
+    int64_t acc = c[N - 1];
+    for (size_t k = N - 1; k-- > 0;) {
+        acc = ((acc * x + (1ll << 29)) >> 30) + c[k];
+    }
+    return acc;
+}
+
+// Rescale a value with frac_bits fractional bits to Q30
+inline int64_t to_q30(int64_t x, int frac_bits)
+{
+    return (frac_bits <= 30) ? x * (1ll << (30 - frac_bits)) : round_shift(x, frac_bits - 30);
+}
+
+// (a * c) >> 30 with rounding, for a Q30 constant 0 < c < 2^32 and |a| < 2^61
+// Splitting a keeps every partial product inside 64 bits
+inline int64_t mul_q30(int64_t a, int64_t c)
+{
+    int64_t hi = a >> 30;
+    int64_t lo = a & (Q30_ONE - 1);
+    return hi * c + ((lo * c + (1ll << 29)) >> 30);
+}
+
+// (a * b) >> shift with rounding for arbitrary 64-bit operands, saturated to
+// +/-2^62. Uses a 32-bit limb product so it needs no 128-bit type.
+inline int64_t mul_shift_sat(int64_t a, int64_t b, int shift)
+{
+    bool neg = (a < 0) != (b < 0);
+    uint64_t ua = (a < 0) ? 0ull - static_cast<uint64_t>(a) : static_cast<uint64_t>(a);
+    uint64_t ub = (b < 0) ? 0ull - static_cast<uint64_t>(b) : static_cast<uint64_t>(b);
+
+    uint64_t a_lo = ua & 0xFFFFFFFFull, a_hi = ua >> 32;
+    uint64_t b_lo = ub & 0xFFFFFFFFull, b_hi = ub >> 32;
+    uint64_t ll = a_lo * b_lo;
+    uint64_t mid1 = a_hi * b_lo;
+    uint64_t mid2 = a_lo * b_hi;
+    uint64_t mid = (ll >> 32) + (mid1 & 0xFFFFFFFFull) + (mid2 & 0xFFFFFFFFull);
+    uint64_t lo = (ll & 0xFFFFFFFFull) | (mid << 32);
+    uint64_t hi = a_hi * b_hi + (mid1 >> 32) + (mid2 >> 32) + (mid >> 32);
+
+    // Round and shift the 128-bit magnitude
+    if (shift > 0) {
+        uint64_t bias = 1ull << (shift - 1);
+        uint64_t sum = lo + bias;
+        hi += (sum < lo) ? 1 : 0;
+        lo = sum;
+        lo = (shift >= 64) ? (hi >> (shift - 64)) : ((lo >> shift) | (hi << (64 - shift)));
+        hi = (shift >= 64) ? 0 : (hi >> shift);
+    }
+
+    const uint64_t limit = 1ull << 62;
+    uint64_t mag = (hi != 0 || lo > limit) ? limit : lo;
+    return neg ? -static_cast<int64_t>(mag) : static_cast<int64_t>(mag);
+}
+
+// Rounded signed division (ties away from zero)
+inline int64_t div_round(int64_t num, int64_t den)
+{
+    if ((num < 0) == (den < 0)) {
+        return (num + den / 2) / den;
+    }
+    return (num - den / 2) / den;
+}
+
+// ========== LOG2 / EXP2 ==========
+
+// log2(x / 2^frac_bits) in Q30, for x > 0
+template<typename Acc>
+inline int64_t log2_q30(uint64_t x, int frac_bits)
+{
+    int e = 63 - count_leading_zeros64(x);
+
+    // x = 2^e * (1 + t), t in [0, 1) as Q30
+    int64_t t = (e >= 30) ? static_cast<int64_t>(x >> (e - 30))
+                          : static_cast<int64_t>(x << (30 - e));
+    t -= Q30_ONE;
+
+    int64_t p = (poly_q30(PolyTier<Acc>::log2_coef, t) * t + (1ll << 29)) >> 30;
+    return static_cast<int64_t>(e - frac_bits) * Q30_ONE + p;
+}
+
+// round(2^(x / 2^30) * 2^out_frac) for a Q30 exponent
+// Returns 0 on underflow and INT64_MAX on overflow (callers saturate)
+template<typename Acc>
+inline int64_t exp2_q30(int64_t x, int out_frac)
+{
+    int64_t n = x >> 30;                       // floor
+    int64_t f = x - n * Q30_ONE;               // [0, 1) as Q30
+    int64_t p = poly_q30(PolyTier<Acc>::exp2_coef, f);   // [1, 2) as Q30
+
+    int64_t shift = 30 - out_frac - n;
+    if (shift >= 62) return 0;
+    if (shift <= -32) return std::numeric_limits<int64_t>::max();
+    return (shift >= 0) ? round_shift(p, static_cast<int>(shift)) : (p << (-shift));
+}
+
+// ========== TANH ==========
+
+// tanh(z) in Q30 for z >= 0 in Q30
+// Segment lookup plus one polynomial; arguments past the last segment clamp
+// to its end, where tanh is within the tier's error of 1. Branch-free so
+// array loops stay straight-line code.
+template<typename Acc>
+inline int64_t tanh_abs_q30(int64_t z)
+{
+    using T = PolyTier<Acc>;
+    constexpr int     seg_bits = T::tanh_seg_bits;
+    constexpr int64_t nseg     = sizeof(T::tanh_coef) / sizeof(T::tanh_coef[0]);
+    constexpr int64_t z_max    = (nseg << (30 - seg_bits)) - 1;
+
+    z = (z < z_max) ? z : z_max;
+    int64_t seg = z >> (30 - seg_bits);
+    int64_t u   = (z << seg_bits) & (Q30_ONE - 1);   // position within the segment
+    return poly_q30(T::tanh_coef[seg], u);
+}
+
+// tanh(x / 2^frac_bits) in Q30 (odd symmetry)
+template<typename Acc>
+inline int64_t tanh_q30(int64_t x, int frac_bits)
+{
+    int64_t th = tanh_abs_q30<Acc>(to_q30((x < 0) ? -x : x, frac_bits));
+    return (x < 0) ? -th : th;
+}
+
+// sigmoid(x / 2^frac_bits) = (1 + tanh(x/2)) / 2, returned in Q31
+template<typename Acc>
+inline int64_t sigmoid_q31(int64_t x, int frac_bits)
+{
+    return Q30_ONE + tanh_q30<Acc>(x, frac_bits + 1);
+}
+
+// ========== SIN / COS / ATAN ==========
+
+// sin(x / 2^frac_bits + quadrant * pi/2) in Q30 (quadrant = 1 gives cos)
+template<typename Acc>
+inline int64_t sin_q30(int64_t x, int frac_bits, int quadrant)
+{
+    // Phase in quarter turns: n + t with t in [-0.5, 0.5]
+    int64_t phase = mul_shift_sat(x, Q61_TWO_OVER_PI, frac_bits + 31);
+    int64_t n = (phase + (1ll << 29)) >> 30;
+    int64_t t = phase - n * Q30_ONE;
+    int64_t t2 = (t * t + (1ll << 29)) >> 30;
+
+    int k = static_cast<int>((n + quadrant) & 3);
+    int64_t r = (k & 1) ? poly_q30(PolyTier<Acc>::cos_coef, t2)
+                        : (poly_q30(PolyTier<Acc>::sin_coef, t2) * t + (1ll << 29)) >> 30;
+    return (k & 2) ? -r : r;
+}
+
+// atan(x / 2^frac_bits) in Q30 radians
+template<typename Acc>
+inline int64_t atan_q30(int64_t x, int frac_bits)
+{
+    bool neg = x < 0;
+    int64_t ax = neg ? -x : x;
+
+    // |x| > 1: atan(x) = pi/2 - atan(1/x)
+    bool inv = ax > (1ll << frac_bits);
+    int64_t t = inv ? div_round(1ll << (30 + frac_bits), ax) : to_q30(ax, frac_bits);
+
+    // t > tan(pi/8): atan(t) = pi/4 + atan((t-1)/(t+1))
+    int64_t base = 0;
+    if (PolyTier<Acc>::atan_reduce && t > Q30_TAN_PI_8) {
+        t = div_round((t - Q30_ONE) * Q30_ONE, t + Q30_ONE);
+        base = Q30_PI_4;
+    }
+
+    int64_t t2 = (t * t + (1ll << 29)) >> 30;
+    int64_t r = base + ((poly_q30(PolyTier<Acc>::atan_coef, t2) * t + (1ll << 29)) >> 30);
+    if (inv) r = Q30_PI_2 - r;
+    return neg ? -r : r;
+}
+
+// ========== BATCHED LOG2 (array paths) ==========
+//
+// The array logarithms run POLY_BLOCK elements at a time in three passes
+// over stack blocks: normalization, the polynomial for the whole block,
+// reconstruction. No pass branches per element, and the polynomial pass is a
+// fixed-degree 64-bit Horner loop that compilers vectorize where the target
+// has 64-bit vector multiplies and arithmetic shifts (AVX2 and up). Every
+// step is the scalar kernel's integer arithmetic, so results are
+// bit-identical to it. The other array transcendentals stay per-element
+// loops: blocking sin/cos and 2^x measured no faster than the scalar kernels.
+
+// Elements per block
+inline constexpr size_t POLY_BLOCK = 64;
+
+// p[i] = P(x[i]) for n <= POLY_BLOCK elements
+template<size_t N>
+inline void poly_q30_block(const int32_t (&c)[N], const int64_t* x, int64_t* p, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        p[i] = poly_q30(c, x[i]);
+    }
+}
+
+// log2_q30 for n 8/16/32-bit elements; non-positive elements give an
+// unspecified value (callers select their own result for them)
+template<typename Acc, typename S>
+inline void log2_q30_block(const S* x, int64_t* out, size_t n, int frac_bits)
+{
+    static_assert(sizeof(S) <= 4, "x < 2^31 keeps the normalization a left shift");
+    int64_t e[POLY_BLOCK], t[POLY_BLOCK];
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t ux = (x[i] > 0) ? static_cast<uint64_t>(x[i]) : 1;
+        e[i] = 63 - count_leading_zeros64(ux);
+        t[i] = static_cast<int64_t>(ux << (30 - e[i])) - Q30_ONE;
+    }
+    poly_q30_block(PolyTier<Acc>::log2_coef, t, out, n);
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = (e[i] - frac_bits) * Q30_ONE + ((out[i] * t[i] + (1ll << 29)) >> 30);
+    }
+}
+
+} // namespace detail
+} // namespace fp
@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
-#include <cmath>
+#include <cstddef>
+#include "poly_approx.hpp"
 
 namespace fp {
 
@@ -10,10 +11,11 @@ struct ReferenceBackend;
 // Power operation implementation for ReferenceBackend
 namespace detail {
 
-// Power function: base^exponent
+// Power function: base^exponent = 2^(exponent * log2(base))
 // Base and exponent can have different Q formats
 // Returns 0 for base <= 0
-template<int Xb, int Yb>
+// Uses the log2/exp2 integer kernels of the selected accuracy tier
+template<int Xb, int Yb, typename Acc = precise>
 inline typename StorageForBits<Xb>::type
 reference_pow(typename StorageForBits<Xb>::type base,
               typename StorageForBits<Yb>::type exponent,
@@ -25,19 +27,26 @@ reference_pow(typename StorageForBits<Xb>::type base,
     // Check for negative or zero base
     if (base <= 0) return 0;
 
-    // Convert base to float
-    float base_f = static_cast<float>(base) / static_cast<float>(1u << base_frac_bits);
+    // log2(base) in Q30
+    int64_t log2_base = log2_q30<Acc>(static_cast<uint64_t>(base), base_frac_bits);
 
-    // Convert exponent to float
-    float exp_f = static_cast<float>(exponent) / static_cast<float>(1u << exp_frac_bits);
+    // exponent * log2(base) in Q30 (saturates far beyond any representable result)
+    int64_t y = mul_shift_sat(exponent, log2_base, exp_frac_bits);
 
-    // Compute pow(base, exponent)
-    float result = std::pow(base_f, exp_f);
-
-    // Convert back to fixed-point with same format as base
-    long long result_scaled = llroundf(result * static_cast<float>(1u << base_frac_bits));
+    // Back to the base's Q format
+    return sat_cast<Out>(exp2_q30<Acc>(y, base_frac_bits));
+}
 
-    return sat_cast<Out>(result_scaled);
+// Element-wise power with a shared exponent: output[i] = base[i]^exponent
+// Same Q format as the base array, 0 for non-positive elements
+template<int Xb, int Yb, typename Acc = precise>
+inline void
+reference_array_pow(const Storage_t<Xb>* base, Storage_t<Xb>* output, size_t length,
+                    Storage_t<Yb> exponent, int base_frac_bits, int exp_frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_pow<Xb, Yb, Acc>(base[i], exponent, base_frac_bits, exp_frac_bits);
+    }
 }
 
 } // namespace detail
@@ -0,0 +1,238 @@
+#pragma once
+#include "../../helpers.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Reduction Engine
+// ============================================================================
+//
+// Shared accumulation loop for dot product, sum, power (sum of squares), mean
+// and rms. It follows the accumulate-then-round scheme of NatureDSP's
+// vec_dot16x16 / vec_power16x16:
+//   1. Every term is accumulated at full precision (no per-term rounding)
+//   2. The loop keeps REDUCE_LANES independent accumulators, so there is no
+//      serial dependency chain and the compiler can map lanes onto SIMD
+//   3. Lanes are combined pairwise, then the total is rounded once
+//
+// Terms narrower than 32 bits (sums, 16x16 products) go into a plain 64-bit
+// accumulator. 32x32 products can reach 2^62, so a handful would already
+// overflow 64 bits; those use a split accumulator (signed high word plus
+// unsigned low word, both 64-bit adds) that is exact for up to 2^32 terms.
+// Integer accumulation is exact, so the result does not depend on the lane
+// count or combination order. On Xtensa, dot_product and array_power take
+// the same exact sums (vec_dot16x16, vec_power16x16 with rsh = 0; other
+// widths, and array_sum, stay on this engine) and agree with the host bit
+// for bit. dot_product_mixed with a shift of 15 or more uses vec_dot32x16,
+// which truncates 15 bits (within 1 LSB); mean and rms run NatureDSP's own
+// kernels on target and are not bit-matched.
+
+inline constexpr int REDUCE_LANES = 4;
+
+// Round |v| / 2^shift half away from zero, like round_shift(); magnitude is
+// given as hi * 2^32 + lo with lo < 2^32. Saturates to INT64_MAX.
+inline int64_t reduce_round_magnitude(uint64_t hi, uint64_t lo, int shift)
+{
+    if (shift > 0) {
+        if (shift > 32) {
+            hi += 1ull << (shift - 33);
+        } else {
+            lo += 1ull << (shift - 1);
+            hi += lo >> 32;
+            lo &= 0xFFFFFFFFull;
+        }
+    }
+
+    constexpr uint64_t kMax = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+    if (shift >= 32) {
+        uint64_t r = (shift >= 96) ? 0 : hi >> (shift - 32);
+        return static_cast<int64_t>(r > kMax ? kMax : r);
+    }
+    if (hi > (kMax >> (32 - shift))) return std::numeric_limits<int64_t>::max();
+    return static_cast<int64_t>((hi << (32 - shift)) | (lo >> shift));
+}
+
+// Plain 64-bit accumulator for terms below 2^32
+struct ReduceAcc64 {
+    int64_t v = 0;
+
+    void add(int64_t term) { v += term; }
+    void merge(const ReduceAcc64& other) { v += other.v; }
+    void normalize() {}
+
+    // round(total / 2^shift), saturated to int64
+    int64_t round_shift(int shift) const { return fp::round_shift(v, shift); }
+
+    // round(total / n)
+    int64_t div_round(size_t n) const {
+        int64_t d = static_cast<int64_t>(n);
+        return (v >= 0) ? (v + d / 2) / d : -((-v + d / 2) / d);
+    }
+};
+
+// Split accumulator for terms up to 2^63: total = hi * 2^32 + lo
+struct ReduceAccWide {
+    int64_t hi = 0;
+    uint64_t lo = 0;
+
+    void add(int64_t term) {
+        hi += term >> 32;                                   // arithmetic: floor
+        lo += static_cast<uint64_t>(term) & 0xFFFFFFFFull;  // remainder, >= 0
+    }
+
+    void merge(const ReduceAccWide& other) {
+        hi += other.hi;
+        lo += other.lo;
+    }
+
+    // Fold the carries out of lo; long-running accumulators (sliding windows)
+    // call this per update so lo never overflows
+    void normalize() {
+        hi += static_cast<int64_t>(lo >> 32);
+        lo &= 0xFFFFFFFFull;
+    }
+
+    // Sign and magnitude of the total (magnitude as mh * 2^32 + ml, ml < 2^32)
+    bool magnitude(uint64_t& mh, uint64_t& ml) const {
+        int64_t h = hi + static_cast<int64_t>(lo >> 32);
+        uint64_t l = lo & 0xFFFFFFFFull;
+        if (h >= 0) {
+            mh = static_cast<uint64_t>(h);
+            ml = l;
+            return false;
+        }
+        // -(h * 2^32 + l) = (-h - 1) * 2^32 + (2^32 - l)
+        mh = static_cast<uint64_t>(-(h + 1));
+        ml = (1ull << 32) - l;
+        if (ml == (1ull << 32)) {
+            ml = 0;
+            ++mh;
+        }
+        return true;
+    }
+
+    int64_t round_shift(int shift) const {
+        uint64_t mh, ml;
+        bool neg = magnitude(mh, ml);
+        int64_t r = reduce_round_magnitude(mh, ml, shift);
+        return neg ? -r : r;
+    }
+
+    // round(total / n); the quotient must fit in int64 (true for means)
+    int64_t div_round(size_t n) const {
+        uint64_t mh, ml;
+        bool neg = magnitude(mh, ml);
+        uint64_t d = static_cast<uint64_t>(n);
+        uint64_t q_hi = mh / d, r = mh % d;
+        uint64_t rem = (r << 32) | ml;                      // r < d < 2^32
+        uint64_t q = (q_hi << 32) + rem / d;
+        if (2 * (rem % d) >= d) ++q;
+        int64_t s = static_cast<int64_t>(q);
+        return neg ? -s : s;
+    }
+};
+
+// Accumulator for products of two Xb-bit storage values: 8x8 and 16x16
+// products fit the plain one, 32x32 products need the split one
+template<int Xb>
+using ReduceProductAcc = std::conditional_t<(sizeof(Storage_t<Xb>) > 2), ReduceAccWide, ReduceAcc64>;
+
+// Accumulate term(i) for i in [0, length) across REDUCE_LANES lanes and
+// combine them pairwise
+template<typename AccT, typename Term>
+inline AccT reduce(size_t length, Term term)
+{
+    AccT lane[REDUCE_LANES];
+    size_t i = 0;
+    for (; i + REDUCE_LANES <= length; i += REDUCE_LANES) {
+        for (int k = 0; k < REDUCE_LANES; ++k) {
+            lane[k].add(term(i + k));
+        }
+    }
+    // Tail of fewer than REDUCE_LANES terms. Counted from 0 against
+    // length - i so the trip count is visibly below REDUCE_LANES: the form
+    // `for (; i < length; ++i)` indexing lane[k++] lets GCC derive an
+    // out-of-bounds lane for constant lengths (-Waggressive-loop-optimizations)
+    for (size_t k = 0; k < length - i; ++k) {
+        lane[k].add(term(i + k));
+    }
+
+    for (int width = 1; width < REDUCE_LANES; width *= 2) {
+        for (int k = 0; k + width < REDUCE_LANES; k += 2 * width) {
+            lane[k].merge(lane[k + width]);
+        }
+    }
+    return lane[0];
+}
+
+// Full-precision sum of products, Q(2 * frac) for same-format operands.
+// Operands are pointers or strided accessors (anything indexable)
+template<int Xb, typename SrcA, typename SrcB>
+inline ReduceProductAcc<Xb>
+reduce_dot(SrcA arr1, SrcB arr2, size_t length)
+{
+    return reduce<ReduceProductAcc<Xb>>(length, [&](size_t i) {
+        return static_cast<int64_t>(arr1[i]) * static_cast<int64_t>(arr2[i]);
+    });
+}
+
+// Mixed-width operands (32-bit data with 16- or 8-bit coefficients): the
+// accumulator follows the wider product. A 32x16 product is below 2^47, so
+// blocks of REDUCE_MIXED_BLOCK terms still fit the plain 64-bit lanes; only
+// the block totals go into the split accumulator. Exact for 2^32 terms.
+inline constexpr size_t REDUCE_MIXED_BLOCK = size_t(1) << 15;
+
+template<int Xb, int Yb>
+using ReduceMixedAcc = std::conditional_t<(sizeof(Storage_t<Xb>) + sizeof(Storage_t<Yb>) > 4),
+                                          ReduceAccWide, ReduceAcc64>;
+
+// Full-precision sum of products, Q(frac_x + frac_y)
+template<int Xb, int Yb, typename SrcA, typename SrcB>
+inline ReduceMixedAcc<Xb, Yb>
+reduce_dot_mixed(SrcA arr1, SrcB arr2, size_t length)
+{
+    auto product = [&](size_t i) { return static_cast<int64_t>(arr1[i]) * static_cast<int64_t>(arr2[i]); };
+    constexpr bool blocked = std::is_same_v<ReduceMixedAcc<Xb, Yb>, ReduceAccWide> &&
+                             (sizeof(Storage_t<Xb>) + sizeof(Storage_t<Yb>) < 8);
+    if constexpr (!blocked) {
+        return reduce<ReduceMixedAcc<Xb, Yb>>(length, product);
+    } else {
+        ReduceAccWide acc;
+        for (size_t begin = 0; begin < length; begin += REDUCE_MIXED_BLOCK) {
+            size_t n = (length - begin < REDUCE_MIXED_BLOCK) ? length - begin : REDUCE_MIXED_BLOCK;
+            ReduceAcc64 block = reduce<ReduceAcc64>(n, [&](size_t i) { return product(begin + i); });
+            acc.add(block.v);
+            acc.normalize();
+        }
+        return acc;
+    }
+}
+
+// Full-precision sum of squares, Q(2 * frac)
+template<int Xb>
+inline ReduceProductAcc<Xb>
+reduce_power(const Storage_t<Xb>* arr, size_t length)
+{
+    return reduce<ReduceProductAcc<Xb>>(length, [&](size_t i) {
+        int64_t v = arr[i];
+        return v * v;
+    });
+}
+
+// Exact sum of elements, same Q format
+template<int Xb>
+inline ReduceAcc64
+reduce_sum(const Storage_t<Xb>* arr, size_t length)
+{
+    return reduce<ReduceAcc64>(length, [&](size_t i) {
+        return static_cast<int64_t>(arr[i]);
+    });
+}
+
+} // namespace detail
+} // namespace fp
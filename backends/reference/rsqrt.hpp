@@ -1,6 +1,8 @@
 #pragma once
 #include "../../helpers.hpp"
-#include <cmath>
+#include "isqrt.hpp"
+#include "poly_approx.hpp"
+#include <cstddef>
 #include <limits>
 
 namespace fp {
@@ -19,15 +21,16 @@ namespace detail {
 //   - If input is Qx.F, output is also Qx.F
 //   - Returns error value (numeric_limits::min()) on negative or zero input
 //
-// Implementation strategy:
-//   1. Convert input to floating-point
-//   2. Compute 1/sqrt(x) using standard library
-//   3. Convert result back to fixed-point with saturation
+// Implementation strategy (integer only, see isqrt.hpp):
+//   1. Normalize the input to a mantissa in [0.25, 1) and an even exponent
+//   2. Seed 1/sqrt(mantissa) from a table and refine with Newton iterations
+//   3. Apply the halved exponent as a rounding shift and saturate
+//   The accuracy tier selects the Newton iteration count (1, 2 or 3)
 //
 // Note: This follows the NatureDSP convention where rsqrt functions
 // return the result in the same format as the input, with 1 LSB mantissa accuracy.
 
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline typename StorageForBits<Xb>::type
 reference_rsqrt(typename StorageForBits<Xb>::type ax, int frac_bits)
 {
@@ -38,20 +41,18 @@ reference_rsqrt(typename StorageForBits<Xb>::type ax, int frac_bits)
         return std::numeric_limits<Out>::min();  // Return error value
     }
 
-    // Convert from fixed-point to float
-    // The value is ax / 2^frac_bits
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
-
-    // Compute reciprocal square root: 1/sqrt(x)
-    float result = 1.0f / std::sqrt(x);
-
-    // Convert back to fixed-point with rounding
-    // Scale by 2^frac_bits and round to nearest
-    float scale = static_cast<float>(1u << frac_bits);
-    long long result_scaled = llroundf(result * scale);
+    return irsqrt_fixed<Out>(ax, frac_bits, frac_bits, PolyTier<Acc>::newton_iters);
+}
 
-    // Saturate to output type range
-    return sat_cast<Out>(result_scaled);
+// Array reciprocal square root: output[i] = 1/sqrt(input[i]), same Q format
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_rsqrt(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                      size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_rsqrt<Xb, Acc>(input[i], frac_bits);
+    }
 }
 
 } // namespace detail
@@ -1,6 +1,8 @@
 #pragma once
 #include "../../helpers.hpp"
-#include <cmath>
+#include "isqrt.hpp"
+#include "poly_approx.hpp"
+#include <cstddef>
 #include <limits>
 
 namespace fp {
@@ -18,16 +20,13 @@ namespace detail {
 //
 // Implementation:
 //   - For Q<I,F> format: sqrt(x_raw / 2^F) = result / 2^F
-//   - This means: sqrt(x_raw) = result * sqrt(2^F) = result * 2^(F/2)
-//   - We compute: result = sqrt(x_raw) / 2^(F/2)
-//
-// Algorithm:
-//   1. Check for negative input (return error value)
-//   2. Convert fixed-point to float
-//   3. Compute floating-point sqrt
-//   4. Convert back to same Q format with proper scaling
+//   - This means: result = sqrt(x_raw * 2^F)
+//   - x_raw * 2^F fits in 63 bits for every bucket, so the integer kernel
+//     from isqrt.hpp (table seed + Newton) gives a correctly rounded result
+//     without any float conversion
+//   - The accuracy tier selects the Newton iteration count (precise = exact)
 
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline typename StorageForBits<Xb>::type
 reference_sqrt(typename StorageForBits<Xb>::type ax, int frac_bits)
 {
@@ -38,17 +37,31 @@ reference_sqrt(typename StorageForBits<Xb>::type ax, int frac_bits)
         return std::numeric_limits<storage_t>::min();  // 0x80000000 or 0x8000
     }
 
-    // Convert to float: value = ax / 2^frac_bits
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
-
-    // Compute sqrt(x)
-    float result = std::sqrt(x);
+    return isqrt_fixed<storage_t>(ax, frac_bits, frac_bits, PolyTier<Acc>::newton_iters);
+}
 
-    // Convert result back to Q format: result_raw = result * 2^frac_bits
-    float scale = static_cast<float>(1u << frac_bits);
-    long long result_scaled = llroundf(result * scale);
+// Array square root: output[i] = sqrt(input[i]), same Q format
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_sqrt(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                     size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_sqrt<Xb, Acc>(input[i], frac_bits);
+    }
+}
 
-    return sat_cast<storage_t>(result_scaled);
+// Wide-input square root (like NatureDSP scl_sqrt64x32)
+// Input: 64-bit value with in_frac_bits, output: Ob-bit storage with out_frac_bits
+// Lets RMS/energy code take the root of a 64-bit accumulator directly
+template<int Ob>
+inline Storage_t<Ob>
+reference_sqrt64(int64_t x, int in_frac_bits, int out_frac_bits)
+{
+    if (x < 0) {
+        return std::numeric_limits<Storage_t<Ob>>::min();
+    }
+    return isqrt_fixed<Storage_t<Ob>>(x, in_frac_bits, out_frac_bits);
 }
 
 } // namespace detail
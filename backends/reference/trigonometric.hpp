@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
-#include <cmath>
+#include <cstddef>
+#include "poly_approx.hpp"
 
 namespace fp {
 namespace detail {
@@ -9,76 +10,94 @@ namespace detail {
 // Reference Trigonometric Implementation
 // ============================================================================
 //
-// Trigonometric functions using standard C++ math library.
+// Trigonometric functions using the integer polynomial kernels of
+// poly_approx.hpp; the accuracy tier selects the polynomial degree.
 // Input is treated as radians in the input Q format.
 // Output maintains the same Q format as input.
 
 // Sine function
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline Storage_t<Xb>
 reference_sin(Storage_t<Xb> ax, int frac_bits)
 {
-    // Convert to float (radians)
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
-
-    // Compute sine
-    float result = std::sin(x);
-
-    // Convert back to fixed-point
-    long long result_scaled = llroundf(result * static_cast<float>(1u << frac_bits));
-
-    return sat_cast<Storage_t<Xb>>(result_scaled);
+    // Q30 result back to the input format
+    int64_t result = sin_q30<Acc>(ax, frac_bits, 0);
+    return sat_cast<Storage_t<Xb>>(round_shift(result, 30 - frac_bits));
 }
 
 // Cosine function
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline Storage_t<Xb>
 reference_cos(Storage_t<Xb> ax, int frac_bits)
 {
-    // Convert to float (radians)
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
-
-    // Compute cosine
-    float result = std::cos(x);
-
-    // Convert back to fixed-point
-    long long result_scaled = llroundf(result * static_cast<float>(1u << frac_bits));
-
-    return sat_cast<Storage_t<Xb>>(result_scaled);
+    // cos(x) = sin(x + pi/2)
+    int64_t result = sin_q30<Acc>(ax, frac_bits, 1);
+    return sat_cast<Storage_t<Xb>>(round_shift(result, 30 - frac_bits));
 }
 
 // Tangent function
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline Storage_t<Xb>
 reference_tan(Storage_t<Xb> ax, int frac_bits)
 {
-    // Convert to float (radians)
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
+    using Out = Storage_t<Xb>;
 
-    // Compute tangent
-    float result = std::tan(x);
+    // tan(x) = sin(x) / cos(x), both Q30
+    int64_t s = sin_q30<Acc>(ax, frac_bits, 0);
+    int64_t c = sin_q30<Acc>(ax, frac_bits, 1);
 
-    // Convert back to fixed-point
-    long long result_scaled = llroundf(result * static_cast<float>(1u << frac_bits));
+    // Pole: saturate towards the sign of sin
+    if (c == 0) {
+        return (s < 0) ? std::numeric_limits<Out>::min() : std::numeric_limits<Out>::max();
+    }
 
-    return sat_cast<Storage_t<Xb>>(result_scaled);
+    return sat_cast<Out>(div_round(s * (1ll << frac_bits), c));
 }
 
 // Arctangent function
-template<int Xb>
+template<int Xb, typename Acc = precise>
 inline Storage_t<Xb>
 reference_atan(Storage_t<Xb> ax, int frac_bits)
 {
-    // Convert to float
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
+    // Result in radians, Q30 back to the input format
+    int64_t result = atan_q30<Acc>(ax, frac_bits);
+    return sat_cast<Storage_t<Xb>>(round_shift(result, 30 - frac_bits));
+}
 
-    // Compute arctangent (result in radians)
-    float result = std::atan(x);
+// ========== ARRAY VERSIONS ==========
+// Same Q format in and out
 
-    // Convert back to fixed-point
-    long long result_scaled = llroundf(result * static_cast<float>(1u << frac_bits));
+// Element-wise sin: radians in, same Q format out
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_sin(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                    size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_sin<Xb, Acc>(input[i], frac_bits);
+    }
+}
+
+// Element-wise cos: radians in, same Q format out
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_cos(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                    size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_cos<Xb, Acc>(input[i], frac_bits);
+    }
+}
 
-    return sat_cast<Storage_t<Xb>>(result_scaled);
+// Element-wise atan: radians out, same Q format
+template<int Xb, typename Acc = precise>
+inline void
+reference_array_atan(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                     size_t length, int frac_bits)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = reference_atan<Xb, Acc>(input[i], frac_bits);
+    }
 }
 
 } // namespace detail
@@ -0,0 +1,116 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "isqrt.hpp"
+#include "reduce.hpp"
+#include "vector_static.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Batched Small-Vector Kernels
+// ============================================================================
+//
+// Kernels behind BatchView: count independent vectors of the same (small)
+// length in transposed layout, element j of vector k at data[j * ld + k].
+// The inner loop runs over k, i.e. across the batch, on contiguous memory:
+// every vector gets its own accumulator lane and the loop over j only
+// advances the row, so a length-8 dot product costs no loop overhead of its
+// own and the lanes map onto SIMD however short the vectors are.
+//
+// Vectors are processed BATCH_TILE at a time so the accumulators stay in
+// registers / L1. Every lane accumulates exactly (the reduction-engine
+// accumulators) and rounds once: dot / power give the exact sum rounded
+// half away from zero and saturated, norm the rounded root of the exact
+// sum of squares.
+
+// Vectors per tile
+inline constexpr size_t BATCH_TILE = 64;
+
+// Per-vector sums of products a[j, k] * b[j, k]; done(k, acc) gets each
+// vector's exact total
+template<int Xb, typename Done>
+inline void
+batch_reduce(const Storage_t<Xb>* a, size_t lda, const Storage_t<Xb>* b, size_t ldb,
+             size_t count, size_t length, Done done)
+{
+    using Acc = ReduceProductAcc<Xb>;
+    for (size_t k0 = 0; k0 < count; k0 += BATCH_TILE) {
+        size_t n = (count - k0 < BATCH_TILE) ? count - k0 : BATCH_TILE;
+        Acc acc[BATCH_TILE];
+        for (size_t j = 0; j < length; ++j) {
+            const Storage_t<Xb>* ra = a + j * lda + k0;
+            const Storage_t<Xb>* rb = b + j * ldb + k0;
+            for (size_t k = 0; k < n; ++k) {
+                acc[k].add(static_cast<int64_t>(ra[k]) * static_cast<int64_t>(rb[k]));
+            }
+        }
+        for (size_t k = 0; k < n; ++k) done(k0 + k, acc[k]);
+    }
+}
+
+// out[k] = dot(a_k, b_k), as reference_dot_product
+template<int Xb>
+inline void
+reference_batch_dot(const Storage_t<Xb>* a, size_t lda, const Storage_t<Xb>* b, size_t ldb,
+                    size_t count, size_t length, Storage_t<Xb>* output, int frac_bits)
+{
+    batch_reduce<Xb>(a, lda, b, ldb, count, length, [&](size_t k, const auto& acc) {
+        output[k] = sat_cast<Storage_t<Xb>>(acc.round_shift(frac_bits));
+    });
+}
+
+// out[k] = sum(x_k^2), as reference_array_power
+template<int Xb>
+inline void
+reference_batch_power(const Storage_t<Xb>* x, size_t ld, size_t count, size_t length,
+                      Storage_t<Xb>* output, int frac_bits)
+{
+    batch_reduce<Xb>(x, ld, x, ld, count, length, [&](size_t k, const auto& acc) {
+        output[k] = sat_cast<Storage_t<Xb>>(acc.round_shift(frac_bits));
+    });
+}
+
+// out[k] = sqrt(sum(x_k^2)): the exact sum of squares (Q(2 * frac)) goes
+// through one rounded integer square root. A 32-bit sum past 2^63 saturates
+// the accumulator read-out, but its root already saturates the output
+template<int Xb>
+inline void
+reference_batch_norm(const Storage_t<Xb>* x, size_t ld, size_t count, size_t length,
+                     Storage_t<Xb>* output, int frac_bits)
+{
+    batch_reduce<Xb>(x, ld, x, ld, count, length, [&](size_t k, const auto& acc) {
+        output[k] = isqrt_fixed<Storage_t<Xb>>(acc.round_shift(0), 2 * frac_bits, frac_bits);
+    });
+}
+
+// y_k += alpha[k] * x_k: the product is rounded and saturated, then added
+// with saturation, as y + alpha * x on FixedPoint
+template<int Xb>
+inline void
+reference_batch_axpy(const Storage_t<Xb>* alpha, const Storage_t<Xb>* x, size_t ldx,
+                     Storage_t<Xb>* y, size_t ldy, size_t count, size_t length, int frac_bits)
+{
+    using S = Storage_t<Xb>;
+    using W = StaticWide<Xb>;
+    for (size_t j = 0; j < length; ++j) {
+        const S* rx = x + j * ldx;
+        S* ry = y + j * ldy;
+        if (frac_bits == 0) {
+            for (size_t k = 0; k < count; ++k) {
+                W p = static_saturate<S>(W(alpha[k]) * W(rx[k]));
+                ry[k] = static_saturate<S>(W(ry[k]) + p);
+            }
+        } else {
+            for (size_t k = 0; k < count; ++k) {
+                W p = static_saturate<S>(static_round_shift(W(alpha[k]) * W(rx[k]), frac_bits));
+                ry[k] = static_saturate<S>(W(ry[k]) + p);
+            }
+        }
+    }
+}
+
+} // namespace detail
+} // namespace fp
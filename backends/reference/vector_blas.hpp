@@ -0,0 +1,132 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "isqrt.hpp"
+#include "reduce.hpp"
+#include "vector_mixed.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference BLAS Level-1 Kernels
+// ============================================================================
+//
+// Fused axpy / axpby / scale / asum / nrm2 with independent Q formats for the
+// scalars, the input and the output. y += alpha * x is one pass with no
+// temporary instead of scale + add over a copy (the NLMS tap update).
+//
+// Products follow FixedPoint::mul<OI, OF> (rounded half away from zero with a
+// compile-time shift, saturated to the output), sums saturate, so each
+// element matches the scalar expression bit for bit:
+//   axpy:  y = y + alpha.mul<YI, YF>(x)
+//   axpby: y = alpha.mul<YI, YF>(x) + beta.mul<YI, YF>(y)
+//   scale: x = alpha.mul<XI, XF>(x)      (gain wider than the data)
+// The loops are branch-free and use a 32-bit intermediate when everything
+// fits, like the mixed-format element-wise kernels. asum and nrm2 accumulate
+// exactly (reduction engine) and round once.
+
+// sat(round(a * b >> Shift)) into D for an A x B product
+template<typename D, typename A, typename B, int Shift>
+struct MixedProduct {
+    static constexpr int bits = static_cast<int>(8 * (sizeof(A) + sizeof(B))) - 1;
+    static_assert(Shift > bits - 64 && Shift < 64, "product shift out of range");
+
+    // |a * b| <= 2^(bits - 1); the rounding bias must not carry past bit 31
+    static constexpr bool narrow = bits <= 31 && Shift >= 0 && Shift <= 30;
+    static constexpr int wide_bits = bits + (Shift < 0 ? -Shift : 0) - (Shift > 0 ? Shift - 1 : 0);
+
+    template<typename W>
+    static D apply(W a, W b) { return mixed_saturate<D, wide_bits>(mixed_align<W, Shift>(a * b)); }
+};
+
+template<int Ab, int Xb, int Yb, int Shift>
+inline void
+reference_array_axpy(Storage_t<Ab> alpha, const Storage_t<Xb>* x, Storage_t<Yb>* y, size_t length)
+{
+    using Y = Storage_t<Yb>;
+    using P = MixedProduct<Y, Storage_t<Ab>, Storage_t<Xb>, Shift>;
+    using W = std::conditional_t<(P::narrow && sizeof(Y) <= 2), int32_t, int64_t>;
+    constexpr int sum_bits = static_cast<int>(8 * sizeof(Y)) + 1;
+
+    for (size_t i = 0; i < length; ++i) {
+        W p = P::template apply<W>(W(alpha), W(x[i]));
+        y[i] = mixed_saturate<Y, sum_bits>(W(y[i]) + p);
+    }
+}
+
+template<int Ab, int Xb, int Bb, int Yb, int ShiftA, int ShiftB>
+inline void
+reference_array_axpby(Storage_t<Ab> alpha, const Storage_t<Xb>* x, Storage_t<Bb> beta, Storage_t<Yb>* y,
+                      size_t length)
+{
+    using Y = Storage_t<Yb>;
+    using PA = MixedProduct<Y, Storage_t<Ab>, Storage_t<Xb>, ShiftA>;
+    using PB = MixedProduct<Y, Storage_t<Bb>, Y, ShiftB>;
+    using W = std::conditional_t<(PA::narrow && PB::narrow && sizeof(Y) <= 2), int32_t, int64_t>;
+    constexpr int sum_bits = static_cast<int>(8 * sizeof(Y)) + 1;
+
+    for (size_t i = 0; i < length; ++i) {
+        W p = PA::template apply<W>(W(alpha), W(x[i]));
+        W q = PB::template apply<W>(W(beta), W(y[i]));
+        y[i] = mixed_saturate<Y, sum_bits>(p + q);
+    }
+}
+
+// In-place scale by a gain of another storage width, Shift = Fa
+template<int Xb, int Ab, int Shift>
+inline void
+reference_array_scale_mixed(Storage_t<Xb>* arr, size_t length, Storage_t<Ab> alpha)
+{
+    using X = Storage_t<Xb>;
+    using P = MixedProduct<X, Storage_t<Ab>, X, Shift>;
+    using W = std::conditional_t<P::narrow, int32_t, int64_t>;
+
+    for (size_t i = 0; i < length; ++i) {
+        arr[i] = P::template apply<W>(W(alpha), W(arr[i]));
+    }
+}
+
+// sum(|x|) rounded by shift = Fx - Fo; |x| is below 2^31, so the plain
+// 64-bit accumulator is exact
+template<int Xb, int Ob>
+inline Storage_t<Ob>
+reference_array_asum(const Storage_t<Xb>* arr, size_t length, int shift)
+{
+    if (length == 0) return 0;
+    auto acc = reduce<ReduceAcc64>(length, [&](size_t i) {
+        int64_t v = arr[i];
+        return v < 0 ? -v : v;
+    });
+    return reduce_round_to<Ob>(acc, shift);
+}
+
+// round(sqrt(total)) of an exact sum of squares with in_frac fractional bits.
+// Totals past 2^62 (long 32-bit sums) drop pairs of low bits first, which
+// keeps the root within rounding of the exact one
+template<typename Out, typename Acc>
+inline Out
+reduce_sqrt(const Acc& acc, int in_frac, int out_frac)
+{
+    int drop = 0;
+    int64_t v = acc.round_shift(0);
+    while (v >= (int64_t(1) << 62)) {
+        drop += 2;
+        v = acc.round_shift(drop);
+    }
+    return isqrt_fixed<Out>(v, in_frac - drop, out_frac);
+}
+
+// Euclidean norm sqrt(sum(x^2)) into out_frac fractional bits
+template<int Xb, int Ob>
+inline Storage_t<Ob>
+reference_array_nrm2(const Storage_t<Xb>* arr, size_t length, int frac_bits, int out_frac)
+{
+    if (length == 0) return 0;
+    return reduce_sqrt<Storage_t<Ob>>(reduce_power<Xb>(arr, length), 2 * frac_bits, out_frac);
+}
+
+} // namespace detail
+} // namespace fp
@@ -0,0 +1,72 @@
+#pragma once
+#include "../../helpers.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Q-Format Conversion (Requantization) Implementation
+// ============================================================================
+//
+// out[i] = sat(round(in[i] * 2^Shift)) from Xb-bit to Yb-bit storage, with
+// Shift = out frac bits - in frac bits fixed at compile time. Right shifts
+// round half away from zero (like round_shift()), every result saturates to
+// the output storage: the same values as the fp::as<I,F>() expression node.
+//
+// The loop body is branch-free and uses the narrowest intermediate that
+// holds the shifted value (32-bit for 8/16-bit inputs), so host compilers
+// turn it into widening unpacks / saturating packs plus vector shifts. The
+// clamp is dropped when the output range cannot be exceeded (widening).
+// Input and output may be the same array when Xb and Yb share a bucket.
+
+// One element of the conversion; the interleave kernels fuse it into their
+// loops
+template<int Xb, int Yb, int Shift>
+struct Requantize {
+    using S = Storage_t<Xb>;
+    using D = Storage_t<Yb>;
+    static constexpr int in_bits = static_cast<int>(8 * sizeof(S));
+    static constexpr int out_bits = static_cast<int>(8 * sizeof(D));
+    static_assert(Shift > -in_bits && Shift < 32, "conversion shift out of range");
+
+    // Widest value the shift can produce, in bits (sign included)
+    static constexpr int wide_bits = in_bits + (Shift > 0 ? Shift : 0);
+    using W = std::conditional_t<(wide_bits <= 31), int32_t, int64_t>;
+    static constexpr bool clamp = wide_bits > out_bits;
+
+    static D apply(S x)
+    {
+        W v = static_cast<W>(x);
+        if constexpr (Shift > 0) {
+            v = v * (W(1) << Shift);
+        } else if constexpr (Shift < 0) {
+            // round half away from zero: floor((v + bias - [v < 0]) / 2^s)
+            constexpr int s = -Shift;
+            constexpr W bias = W(1) << (s - 1);
+            v = (v + bias - static_cast<W>(v < 0)) >> s;
+        }
+        if constexpr (clamp) {
+            constexpr W lo = static_cast<W>(std::numeric_limits<D>::min());
+            constexpr W hi = static_cast<W>(std::numeric_limits<D>::max());
+            v = v < lo ? lo : v;
+            v = v > hi ? hi : v;
+        }
+        return static_cast<D>(v);
+    }
+};
+
+template<int Xb, int Yb, int Shift>
+inline void
+reference_array_convert(const Storage_t<Xb>* in, Storage_t<Yb>* out, size_t length)
+{
+    for (size_t i = 0; i < length; ++i) {
+        out[i] = Requantize<Xb, Yb, Shift>::apply(in[i]);
+    }
+}
+
+} // namespace detail
+} // namespace fp
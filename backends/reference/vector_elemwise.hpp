@@ -56,5 +56,19 @@ reference_array_sub(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
     }
 }
 
+// Fused expression evaluation: output[i] = expr[i]
+// expr is an fp::ArrayExpr tree (see fp.hpp) whose operator[] already applies
+// each stage's rounding and saturation; this is the single loop that replaces
+// one pass per operator. Element i reads only index i of every operand, so
+// the output may alias an operand.
+template<int Xb, typename Expr>
+inline void
+reference_array_eval(const Expr& expr, Storage_t<Xb>* output, size_t length)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = sat_cast<Storage_t<Xb>>(expr[i]);
+    }
+}
+
 } // namespace detail
 } // namespace fp
@@ -0,0 +1,134 @@
+#pragma once
+#include "../../helpers.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Float <-> Fixed Bulk Conversion Implementation
+// ============================================================================
+//
+// Array versions of FixedPoint(float) and to_float(), bit-identical to them
+// for every finite input, without the per-element libm call:
+//   - float -> fixed: scale by 2^frac, round half away from zero (llroundf),
+//     saturate to the storage range. The rounding is a truncating convert
+//     plus a correction from the exact fraction s - trunc(s), so there is no
+//     s + 0.5 double rounding; NaN maps to 0.
+//   - fixed -> float: int -> float convert times 2^-frac (exact, the same
+//     value as the scalar divide); a plain loop the compiler vectorizes
+//
+// The float compares of float -> fixed keep compilers from vectorizing it
+// under default (trapping) math, so SSE2 hosts get an explicit kernel:
+// cvttps2dq, the same fraction correction on compare masks, and
+// packssdw / packsswb for the saturating narrowing. Other hosts and the
+// tails run the scalar loop.
+
+// Scalar element: the definition the SIMD kernel reproduces
+template<typename S>
+inline S from_float_element(float v, float scale)
+{
+    float s = v * scale;
+    if (!(s == s)) return 0;
+    if constexpr (sizeof(S) == 4) {
+        if (s >= 2147483648.0f) return std::numeric_limits<int32_t>::max();
+        if (s < -2147483648.0f) return std::numeric_limits<int32_t>::min();
+    } else {
+        // clamp well inside int32, round, then saturate as integers
+        s = s < 1073741824.0f ? s : 1073741824.0f;
+        s = s > -1073741824.0f ? s : -1073741824.0f;
+    }
+    int32_t t = static_cast<int32_t>(s);
+    float frac = s - static_cast<float>(t);
+    t += (frac >= 0.5f) - (frac <= -0.5f);
+    return sat_cast<S>(t);
+}
+
+#if defined(__SSE2__)
+// Four rounded values as int32 lanes (8/16-bit storage: |s| clamped to 2^30,
+// the packs saturate; 32-bit: saturated here)
+template<typename S>
+inline __m128i from_float_sse2(const float* in, __m128 scale)
+{
+    __m128 s = _mm_mul_ps(_mm_loadu_ps(in), scale);
+    s = _mm_and_ps(s, _mm_cmpord_ps(s, s));                     // NaN -> 0
+
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 neg_half = _mm_set1_ps(-0.5f);
+    if constexpr (sizeof(S) == 4) {
+        const __m128 top = _mm_set1_ps(2147483648.0f);
+        __m128 over = _mm_cmpge_ps(s, top);
+        __m128 in_range = _mm_andnot_ps(over, _mm_cmpge_ps(s, _mm_set1_ps(-2147483648.0f)));
+        __m128i t = _mm_cvttps_epi32(s);                        // out of range: INT32_MIN
+        __m128 frac = _mm_and_ps(_mm_sub_ps(s, _mm_cvtepi32_ps(t)), in_range);
+        // compare masks are -1 where true: t + up - down
+        t = _mm_sub_epi32(t, _mm_castps_si128(_mm_cmpge_ps(frac, half)));
+        t = _mm_add_epi32(t, _mm_castps_si128(_mm_cmple_ps(frac, neg_half)));
+        __m128i max = _mm_set1_epi32(std::numeric_limits<int32_t>::max());
+        __m128i o = _mm_castps_si128(over);
+        return _mm_or_si128(_mm_andnot_si128(o, t), _mm_and_si128(o, max));
+    } else {
+        const __m128 bound = _mm_set1_ps(1073741824.0f);
+        s = _mm_min_ps(_mm_max_ps(s, _mm_sub_ps(_mm_setzero_ps(), bound)), bound);
+        __m128i t = _mm_cvttps_epi32(s);
+        __m128 frac = _mm_sub_ps(s, _mm_cvtepi32_ps(t));
+        t = _mm_sub_epi32(t, _mm_castps_si128(_mm_cmpge_ps(frac, half)));
+        return _mm_add_epi32(t, _mm_castps_si128(_mm_cmple_ps(frac, neg_half)));
+    }
+}
+#endif
+
+template<int Xb>
+inline void
+reference_array_from_float(const float* in, Storage_t<Xb>* out, size_t length, int frac_bits)
+{
+    using S = Storage_t<Xb>;
+    const float scale = static_cast<float>(1u << frac_bits);
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128 vscale = _mm_set1_ps(scale);
+    if constexpr (sizeof(S) == 4) {
+        for (; i + 4 <= length; i += 4) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), from_float_sse2<S>(in + i, vscale));
+        }
+    } else if constexpr (sizeof(S) == 2) {
+        for (; i + 8 <= length; i += 8) {
+            __m128i lo = from_float_sse2<S>(in + i, vscale);
+            __m128i hi = from_float_sse2<S>(in + i + 4, vscale);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(lo, hi));
+        }
+    } else {
+        for (; i + 16 <= length; i += 16) {
+            __m128i a = _mm_packs_epi32(from_float_sse2<S>(in + i, vscale),
+                                        from_float_sse2<S>(in + i + 4, vscale));
+            __m128i b = _mm_packs_epi32(from_float_sse2<S>(in + i + 8, vscale),
+                                        from_float_sse2<S>(in + i + 12, vscale));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi16(a, b));
+        }
+    }
+#endif
+
+    for (; i < length; ++i) {
+        out[i] = from_float_element<S>(in[i], scale);
+    }
+}
+
+template<int Xb>
+inline void
+reference_array_to_float(const Storage_t<Xb>* in, float* out, size_t length, int frac_bits)
+{
+    const float inv_scale = 1.0f / static_cast<float>(1u << frac_bits);
+    for (size_t i = 0; i < length; ++i) {
+        out[i] = static_cast<float>(in[i]) * inv_scale;
+    }
+}
+
+} // namespace detail
+} // namespace fp
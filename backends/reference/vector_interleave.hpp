@@ -0,0 +1,147 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "vector_convert.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Interleave / Deinterleave / Layout Conversion Kernels
+// ============================================================================
+//
+// Multichannel audio arrives interleaved (frame f of channel c at
+// in[f * stride + c]) while the array kernels want one contiguous plane per
+// channel. These kernels move between the two layouts in one pass, with the
+// Q conversion fused in (Requantize: the same values as array_convert).
+//
+// Each channel is one loop over the frames with a single store stream and a
+// constant-distance load stream (or the reverse). Strides of 2, 4 and 8 are
+// compile-time constants, which the compiler turns into deinterleaving vector
+// loads / interleaving stores plus the conversion's widen / narrow; other
+// channel counts use a runtime stride. Frames go INTERLEAVE_TILE at a time,
+// so the interleaved side of a tile stays in L1 while its channels are
+// visited in turn (a single tile for the usual 32..256-frame blocks).
+//
+// matrix_convert is the general AoS <-> SoA block copy for any row / column
+// strides: same-orientation copies run row by row, transposes go through
+// TRANSPOSE_TILE x TRANSPOSE_TILE tiles so both sides are touched in short
+// contiguous runs.
+
+// Frames per interleave / deinterleave step
+inline constexpr size_t INTERLEAVE_TILE = 256;
+
+// Edge of a transpose tile
+inline constexpr size_t TRANSPOSE_TILE = 16;
+
+// Call fn with the frame stride as a compile-time constant where it pays off
+// (0 = runtime stride)
+template<typename Fn>
+inline void with_frame_stride(size_t stride, Fn&& fn)
+{
+    switch (stride) {
+    case 2:  fn(std::integral_constant<size_t, 2>{}); break;
+    case 4:  fn(std::integral_constant<size_t, 4>{}); break;
+    case 8:  fn(std::integral_constant<size_t, 8>{}); break;
+    default: fn(std::integral_constant<size_t, 0>{}); break;
+    }
+}
+
+// planes[c][f] = in[f * stride + c], c < channels <= stride
+template<int Xb, int Yb, int Shift>
+inline void
+reference_array_deinterleave(const Storage_t<Xb>* in, size_t stride, Storage_t<Yb>* const* planes,
+                             size_t channels, size_t frames)
+{
+    using Cv = Requantize<Xb, Yb, Shift>;
+    with_frame_stride(stride, [&](auto fixed) {
+        constexpr size_t Stride = decltype(fixed)::value;
+        const size_t step = Stride != 0 ? Stride : stride;
+        for (size_t f0 = 0; f0 < frames; f0 += INTERLEAVE_TILE) {
+            size_t n = (frames - f0 < INTERLEAVE_TILE) ? frames - f0 : INTERLEAVE_TILE;
+            const Storage_t<Xb>* src = in + f0 * step;
+            for (size_t c = 0; c < channels; ++c) {
+                Storage_t<Yb>* dst = planes[c] + f0;
+                for (size_t f = 0; f < n; ++f) dst[f] = Cv::apply(src[f * step + c]);
+            }
+        }
+    });
+}
+
+// out[f * stride + c] = planes[c][f], c < channels <= stride
+template<int Xb, int Yb, int Shift>
+inline void
+reference_array_interleave(const Storage_t<Xb>* const* planes, Storage_t<Yb>* out, size_t stride,
+                           size_t channels, size_t frames)
+{
+    using Cv = Requantize<Xb, Yb, Shift>;
+    with_frame_stride(stride, [&](auto fixed) {
+        constexpr size_t Stride = decltype(fixed)::value;
+        const size_t step = Stride != 0 ? Stride : stride;
+        for (size_t f0 = 0; f0 < frames; f0 += INTERLEAVE_TILE) {
+            size_t n = (frames - f0 < INTERLEAVE_TILE) ? frames - f0 : INTERLEAVE_TILE;
+            Storage_t<Yb>* dst = out + f0 * step;
+            for (size_t c = 0; c < channels; ++c) {
+                const Storage_t<Xb>* src = planes[c] + f0;
+                for (size_t f = 0; f < n; ++f) dst[f * step + c] = Cv::apply(src[f]);
+            }
+        }
+    });
+}
+
+// out(r, c) = in(r, c) for rows x cols matrices with element strides
+// (rs = between rows, cs = between columns)
+template<int Xb, int Yb, int Shift>
+inline void
+reference_matrix_convert(const Storage_t<Xb>* in, ptrdiff_t in_rs, ptrdiff_t in_cs,
+                         Storage_t<Yb>* out, ptrdiff_t out_rs, ptrdiff_t out_cs, size_t rows, size_t cols)
+{
+    using Cv = Requantize<Xb, Yb, Shift>;
+    auto at = [](auto* p, size_t r, ptrdiff_t rs, size_t c, ptrdiff_t cs) {
+        return p + static_cast<ptrdiff_t>(r) * rs + static_cast<ptrdiff_t>(c) * cs;
+    };
+
+    // Same orientation: contiguous runs on both sides
+    if (in_cs == 1 && out_cs == 1) {
+        for (size_t r = 0; r < rows; ++r) {
+            reference_array_convert<Xb, Yb, Shift>(at(in, r, in_rs, 0, 1), at(out, r, out_rs, 0, 1), cols);
+        }
+        return;
+    }
+    if (in_rs == 1 && out_rs == 1) {
+        for (size_t c = 0; c < cols; ++c) {
+            reference_array_convert<Xb, Yb, Shift>(at(in, 0, 1, c, in_cs), at(out, 0, 1, c, out_cs), rows);
+        }
+        return;
+    }
+
+    // Transpose (or arbitrary strides): tile by tile, the inner loop along
+    // the output's unit stride when it has one
+    const bool out_col_runs = out_rs == 1;
+    for (size_t r0 = 0; r0 < rows; r0 += TRANSPOSE_TILE) {
+        size_t nr = (rows - r0 < TRANSPOSE_TILE) ? rows - r0 : TRANSPOSE_TILE;
+        for (size_t c0 = 0; c0 < cols; c0 += TRANSPOSE_TILE) {
+            size_t nc = (cols - c0 < TRANSPOSE_TILE) ? cols - c0 : TRANSPOSE_TILE;
+            if (out_col_runs) {
+                for (size_t c = c0; c < c0 + nc; ++c) {
+                    const Storage_t<Xb>* src = at(in, r0, in_rs, c, in_cs);
+                    Storage_t<Yb>* dst = at(out, r0, 1, c, out_cs);
+                    for (size_t r = 0; r < nr; ++r) dst[r] = Cv::apply(src[static_cast<ptrdiff_t>(r) * in_rs]);
+                }
+            } else {
+                for (size_t r = r0; r < r0 + nr; ++r) {
+                    const Storage_t<Xb>* src = at(in, r, in_rs, c0, in_cs);
+                    Storage_t<Yb>* dst = at(out, r, out_rs, c0, out_cs);
+                    for (size_t c = 0; c < nc; ++c) {
+                        dst[static_cast<ptrdiff_t>(c) * out_cs] = Cv::apply(src[static_cast<ptrdiff_t>(c) * in_cs]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace detail
+} // namespace fp
@@ -1,7 +1,9 @@
 #pragma once
 #include "../../helpers.hpp"
+#include "reduce.hpp"
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 
 namespace fp {
 namespace detail {
@@ -10,8 +12,16 @@ namespace detail {
 // Reference Vector Min/Max Implementation
 // ============================================================================
 //
-// Array operations that find minimum/maximum values in arrays.
+// Array operations that find minimum/maximum values in arrays, plus the
+// element-wise min/max/abs/clip/select family (limiters, rectifiers, ReLU).
 // These operations work on arrays of fixed-point values stored as integers.
+// The element-wise loops are branch-free compare/selects so the compiler can
+// vectorize them; output may alias an input.
+//
+// argmin/argmax return the value and its index in one pass. Like the
+// reduction engine, the loop keeps REDUCE_LANES independent (value, index)
+// lanes with no serial dependency; lanes are merged at the end, preferring
+// the lower index on ties, so the result is always the first occurrence.
 
 // Find minimum value in array
 template<int Xb>
@@ -45,5 +55,189 @@ reference_array_max(const Storage_t<Xb>* arr, size_t length)
     return max_val;
 }
 
+// Element-wise maximum: output[i] = max(arr1[i], arr2[i])
+template<int Xb>
+inline void
+reference_array_elemax(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                       Storage_t<Xb>* output, size_t length)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = std::max(arr1[i], arr2[i]);
+    }
+}
+
+// Element-wise minimum: output[i] = min(arr1[i], arr2[i])
+template<int Xb>
+inline void
+reference_array_elemin(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                       Storage_t<Xb>* output, size_t length)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = std::min(arr1[i], arr2[i]);
+    }
+}
+
+// Element-wise absolute value, saturating (|min| -> max)
+template<int Xb>
+inline void
+reference_array_abs(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length)
+{
+    for (size_t i = 0; i < length; ++i) {
+        int64_t v = input[i];
+        output[i] = sat_cast<Storage_t<Xb>>(v < 0 ? -v : v);
+    }
+}
+
+// Clip to [lo, hi]: output[i] = min(max(input[i], lo), hi)
+template<int Xb>
+inline void
+reference_array_clip(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length,
+                     Storage_t<Xb> lo, Storage_t<Xb> hi)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = std::min(std::max(input[i], lo), hi);
+    }
+}
+
+// Threshold: output[i] = input[i] < threshold ? value : input[i]
+// (ReLU is threshold = value = 0, a noise gate is value = 0)
+template<int Xb>
+inline void
+reference_array_threshold(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length,
+                          Storage_t<Xb> threshold, Storage_t<Xb> value)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = (input[i] < threshold) ? value : input[i];
+    }
+}
+
+// Threshold select: output[i] = input[i] > threshold ? above[i] : below[i]
+template<int Xb>
+inline void
+reference_array_select(const Storage_t<Xb>* input, const Storage_t<Xb>* above,
+                       const Storage_t<Xb>* below, Storage_t<Xb>* output, size_t length,
+                       Storage_t<Xb> threshold)
+{
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = (input[i] > threshold) ? above[i] : below[i];
+    }
+}
+
+// Value and index of the first minimum (Max = false) or maximum (Max = true);
+// index 0 and value 0 for an empty array. arr is a pointer or a strided accessor
+template<int Xb, bool Max, typename Src>
+inline size_t
+reference_array_argext(Src arr, size_t length, Storage_t<Xb>& value)
+{
+    if (length == 0) {
+        value = 0;
+        return 0;
+    }
+
+    Storage_t<Xb> best[REDUCE_LANES];
+    size_t index[REDUCE_LANES];
+    for (int k = 0; k < REDUCE_LANES; ++k) {
+        best[k] = arr[0];
+        index[k] = 0;
+    }
+
+    // Strict compares keep the first occurrence within a lane
+    size_t i = 0;
+    for (; i + REDUCE_LANES <= length; i += REDUCE_LANES) {
+        for (int k = 0; k < REDUCE_LANES; ++k) {
+            Storage_t<Xb> v = arr[i + k];
+            bool take = Max ? (v > best[k]) : (v < best[k]);
+            best[k]  = take ? v : best[k];
+            index[k] = take ? i + k : index[k];
+        }
+    }
+    for (size_t k = 0; k < length - i; ++k) {
+        Storage_t<Xb> v = arr[i + k];
+        if (Max ? (v > best[0]) : (v < best[0])) {
+            best[0] = v;
+            index[0] = i + k;
+        }
+    }
+
+    for (int k = 1; k < REDUCE_LANES; ++k) {
+        bool better = Max ? (best[k] > best[0]) : (best[k] < best[0]);
+        if (better || (best[k] == best[0] && index[k] < index[0])) {
+            best[0] = best[k];
+            index[0] = index[k];
+        }
+    }
+    value = best[0];
+    return index[0];
+}
+
+template<int Xb>
+inline size_t
+reference_array_argmin(const Storage_t<Xb>* arr, size_t length, Storage_t<Xb>& value)
+{
+    return reference_array_argext<Xb, false>(arr, length, value);
+}
+
+template<int Xb>
+inline size_t
+reference_array_argmax(const Storage_t<Xb>* arr, size_t length, Storage_t<Xb>& value)
+{
+    return reference_array_argext<Xb, true>(arr, length, value);
+}
+
+// The k largest values (k is small: a handful of spectral peaks), sorted in
+// descending order with ties by lower index. Each element costs one compare
+// against the current k-th value; only the rare accepted ones are inserted.
+// Returns min(k, length), the number of entries written.
+template<int Xb>
+inline size_t
+reference_array_top_k(const Storage_t<Xb>* arr, size_t length,
+                      Storage_t<Xb>* values, size_t* indices, size_t k)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < length; ++i) {
+        Storage_t<Xb> v = arr[i];
+        if (count == k && (k == 0 || v <= values[k - 1])) continue;
+
+        size_t pos = (count < k) ? count++ : k - 1;
+        while (pos > 0 && values[pos - 1] < v) {
+            values[pos] = values[pos - 1];
+            indices[pos] = indices[pos - 1];
+            --pos;
+        }
+        values[pos] = v;
+        indices[pos] = i;
+    }
+    return count;
+}
+
+// Local maxima strictly above threshold, in index order. A peak is higher
+// than its left neighbour and higher than the first differing sample to its
+// right, so a flat-topped peak is reported once, at its first sample; the
+// end points are never peaks. Writes at most max_peaks indices and returns
+// the number written.
+template<int Xb>
+inline size_t
+reference_array_find_peaks(const Storage_t<Xb>* arr, size_t length, Storage_t<Xb> threshold,
+                           size_t* indices, size_t max_peaks)
+{
+    size_t count = 0;
+    size_t i = 1;
+    while (i + 1 < length && count < max_peaks) {
+        Storage_t<Xb> v = arr[i];
+        if (v <= threshold || v <= arr[i - 1]) {
+            ++i;
+            continue;
+        }
+
+        size_t j = i + 1;
+        while (j < length && arr[j] == v) ++j;
+        if (j < length && arr[j] < v) {
+            indices[count++] = i;
+        }
+        i = j;
+    }
+    return count;
+}
+
 } // namespace detail
 } // namespace fp
@@ -0,0 +1,135 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "reduce.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Mixed-Format Element-wise Operations and Dot Product
+// ============================================================================
+//
+// Element-wise multiply / add / subtract where the two inputs and the output
+// each have their own storage width and Q format. The alignment shifts and
+// the final rounding are compile-time constants applied inside the one loop,
+// so a Q1.31 x Q5.26 -> Q1.31 product needs no separate conversion pass.
+//
+// Shifts follow the scalar FixedPoint::mul / add / sub<OI, OF> convention:
+// a positive shift is a right shift that rounds half away from zero
+// (round_shift()), a negative one is an exact left shift. Every element
+// matches the scalar operation on the same values bit for bit:
+//   elemult: out = sat(round(a * b >> Shift)),  Shift = Fa + Fb - Fo
+//   add/sub: out = sat(round(a >> ShiftA) +/- round(b >> ShiftB)),
+//            ShiftA = Fa - Fo, ShiftB = Fb - Fo
+// The loops are branch-free and use a 32-bit intermediate when the widest
+// value fits, so 8/16-bit formats vectorize like the same-format kernels.
+// The output may alias an input with the same storage type.
+
+// Bits (sign included) of an S value after the shift (left shifts widen it)
+template<typename S, int Shift>
+inline constexpr int mixed_aligned_bits = static_cast<int>(8 * sizeof(S)) + (Shift < 0 ? -Shift : 0);
+
+// round(v / 2^Shift) half away from zero, or v * 2^-Shift for Shift < 0
+template<typename W, int Shift>
+inline W mixed_align(W v)
+{
+    if constexpr (Shift > 0) {
+        constexpr W bias = W(1) << (Shift - 1);
+        return (v + bias - static_cast<W>(v < 0)) >> Shift;
+    } else if constexpr (Shift < 0) {
+        return v * (W(1) << -Shift);
+    } else {
+        return v;
+    }
+}
+
+// Saturate to D; the compare is dropped when W values always fit
+template<typename D, int WideBits, typename W>
+inline D mixed_saturate(W v)
+{
+    if constexpr (WideBits > static_cast<int>(8 * sizeof(D))) {
+        constexpr W lo = static_cast<W>(std::numeric_limits<D>::min());
+        constexpr W hi = static_cast<W>(std::numeric_limits<D>::max());
+        v = v < lo ? lo : v;
+        v = v > hi ? hi : v;
+    }
+    return static_cast<D>(v);
+}
+
+template<int Xb, int Yb, int Ob, int Shift>
+inline void
+reference_array_elemult_mixed(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2,
+                              Storage_t<Ob>* output, size_t length)
+{
+    using A = Storage_t<Xb>;
+    using B = Storage_t<Yb>;
+    using D = Storage_t<Ob>;
+    constexpr int prod_bits = static_cast<int>(8 * (sizeof(A) + sizeof(B))) - 1;
+    static_assert(Shift > prod_bits - 64 && Shift < 64, "elemult shift out of range");
+
+    // |a * b| <= 2^(prod_bits - 1); the rounding bias must not carry past bit 31
+    constexpr bool narrow = prod_bits <= 31 && Shift >= 0 && Shift <= 30;
+    using W = std::conditional_t<narrow, int32_t, int64_t>;
+    constexpr int wide_bits = prod_bits + (Shift < 0 ? -Shift : 0) - (Shift > 0 ? Shift - 1 : 0);
+
+    for (size_t i = 0; i < length; ++i) {
+        W p = static_cast<W>(arr1[i]) * static_cast<W>(arr2[i]);
+        output[i] = mixed_saturate<D, wide_bits>(mixed_align<W, Shift>(p));
+    }
+}
+
+template<int Xb, int Yb, int Ob, int ShiftA, int ShiftB, bool Subtract>
+inline void
+reference_array_addsub_mixed(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2,
+                             Storage_t<Ob>* output, size_t length)
+{
+    using A = Storage_t<Xb>;
+    using B = Storage_t<Yb>;
+    using D = Storage_t<Ob>;
+    constexpr int a_bits = mixed_aligned_bits<A, ShiftA>;
+    constexpr int b_bits = mixed_aligned_bits<B, ShiftB>;
+    constexpr int wide_bits = (a_bits > b_bits ? a_bits : b_bits) + 1;
+    static_assert(wide_bits <= 64 && ShiftA < 32 && ShiftB < 32, "add/sub shift out of range");
+
+    using W = std::conditional_t<(wide_bits <= 31), int32_t, int64_t>;
+
+    for (size_t i = 0; i < length; ++i) {
+        W a = mixed_align<W, ShiftA>(static_cast<W>(arr1[i]));
+        W b = mixed_align<W, ShiftB>(static_cast<W>(arr2[i]));
+        output[i] = mixed_saturate<D, wide_bits>(Subtract ? a - b : a + b);
+    }
+}
+
+// sat(round(total >> shift)) of an exact accumulator into Ob-bit storage;
+// a negative shift is a left shift that saturates instead of overflowing
+template<int Ob, typename Acc>
+inline Storage_t<Ob>
+reduce_round_to(const Acc& acc, int shift)
+{
+    if (shift >= 0) return sat_cast<Storage_t<Ob>>(acc.round_shift(shift));
+
+    int64_t v = acc.round_shift(0);
+    if (v == 0) return 0;
+    int64_t limit = (-shift >= 63) ? 0 : std::numeric_limits<int64_t>::max() >> -shift;
+    if (v > limit) return std::numeric_limits<Storage_t<Ob>>::max();
+    if (v < -limit) return std::numeric_limits<Storage_t<Ob>>::min();
+    return sat_cast<Storage_t<Ob>>(v * (int64_t(1) << -shift));
+}
+
+// Mixed-precision dot product (32-bit data with 16-bit taps and the like):
+// sat(round(sum(a * b) >> shift)), shift = Fa + Fb - Fo; the sum is exact
+// (reduce_dot_mixed) and rounded once, negative shifts saturate
+template<int Xb, int Yb, int Ob>
+inline Storage_t<Ob>
+reference_dot_product_mixed(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2, size_t length, int shift)
+{
+    if (length == 0) return 0;
+    return reduce_round_to<Ob>(reduce_dot_mixed<Xb, Yb>(arr1, arr2, length), shift);
+}
+
+} // namespace detail
+} // namespace fp
@@ -1,5 +1,6 @@
 #pragma once
 #include "../../helpers.hpp"
+#include "reduce.hpp"
 #include <cstddef>
 
 namespace fp {
@@ -9,11 +10,13 @@ namespace detail {
 // Reference Vector Operations Implementation
 // ============================================================================
 //
-// Array operations for dot product and sum.
+// Array operations for dot product, sum and power (sum of squares).
 // These operations work on arrays of fixed-point values stored as integers.
+// All three accumulate at full precision through the reduction engine
+// (reduce.hpp), round once and saturate to the storage type.
 
 // Compute dot product of two arrays
-// Performs fixed-point multiplication with proper scaling
+// Products are summed in Q(2*frac_bits), then shifted back to frac_bits
 template<int Xb>
 inline Storage_t<Xb>
 reference_dot_product(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size_t length, int frac_bits)
@@ -22,16 +25,11 @@ reference_dot_product(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size
         return 0;  // Return 0 for empty array
     }
 
-    long long result = 0;
-    for (size_t i = 0; i < length; ++i) {
-        // Fixed-point multiply: multiply then shift right by frac_bits
-        long long product = static_cast<long long>(arr1[i]) * static_cast<long long>(arr2[i]);
-        result += round_shift(product, frac_bits);
-    }
-    return sat_cast<Storage_t<Xb>>(result);
+    auto acc = reduce_dot<Xb>(arr1, arr2, length);
+    return sat_cast<Storage_t<Xb>>(acc.round_shift(frac_bits));
 }
 
-// Compute sum of all elements in array
+// Compute sum of all elements in array (saturating)
 template<int Xb>
 inline Storage_t<Xb>
 reference_array_sum(const Storage_t<Xb>* arr, size_t length)
@@ -40,11 +38,21 @@ reference_array_sum(const Storage_t<Xb>* arr, size_t length)
         return 0;  // Return 0 for empty array
     }
 
-    Storage_t<Xb> sum = 0;
-    for (size_t i = 0; i < length; ++i) {
-        sum += arr[i];
+    return sat_cast<Storage_t<Xb>>(reduce_sum<Xb>(arr, length).v);
+}
+
+// Compute power (sum of squares) of an array, same Q format
+// Like vec_power* with rsh = frac_bits
+template<int Xb>
+inline Storage_t<Xb>
+reference_array_power(const Storage_t<Xb>* arr, size_t length, int frac_bits)
+{
+    if (length == 0) {
+        return 0;  // Return 0 for empty array
     }
-    return sum;
+
+    auto acc = reduce_power<Xb>(arr, length);
+    return sat_cast<Storage_t<Xb>>(acc.round_shift(frac_bits));
 }
 
 } // namespace detail
@@ -0,0 +1,49 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "../../parallel.hpp"
+#include "reduce.hpp"
+#include "vector_ops.hpp"
+#include "vector_stats.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Parallel Reduction Kernels
+// ============================================================================
+//
+// Chunked versions of the reduction-engine kernels for parallel_policy. Each
+// chunk runs the serial accumulation loop and returns its exact total; the
+// totals are merged in chunk order and rounded once, exactly like the serial
+// kernel. Integer accumulation is exact, so the result is bit-identical to it.
+// Lengths that fit in one chunk (or a single-thread pool) take the serial path.
+
+template<int Xb>
+inline Storage_t<Xb>
+reference_parallel_dot(const parallel_policy& policy, const Storage_t<Xb>* arr1,
+                       const Storage_t<Xb>* arr2, size_t length, int frac_bits)
+{
+    ReduceProductAcc<Xb> acc;
+    bool split = parallel_reduce(policy, length, sizeof(Storage_t<Xb>), acc, [&](size_t begin, size_t n) {
+        return reduce_dot<Xb>(arr1 + begin, arr2 + begin, n);
+    });
+    if (!split) return reference_dot_product<Xb>(arr1, arr2, length, frac_bits);
+    return sat_cast<Storage_t<Xb>>(acc.round_shift(frac_bits));
+}
+
+template<int Xb, unsigned Mask>
+inline ArrayStatsRaw<Storage_t<Xb>>
+reference_parallel_stats(const parallel_policy& policy, const Storage_t<Xb>* arr, size_t length, int frac_bits)
+{
+    StatsAcc<Xb, Mask> acc;
+    bool split = parallel_reduce(policy, length, sizeof(Storage_t<Xb>), acc, [&](size_t begin, size_t n) {
+        return reference_stats_accumulate<Xb, Mask>(arr + begin, n);
+    });
+    if (!split) return reference_array_stats<Xb, Mask>(arr, length, frac_bits);
+    return reference_stats_finish<Xb, Mask>(acc, length, frac_bits);
+}
+
+} // namespace detail
+} // namespace fp
@@ -0,0 +1,161 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "vector_mixed.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Compile-Time Polynomial Kernel
+// ============================================================================
+//
+// y = c0 + c1 x + ... + cn x^n over an array, with the coefficients as
+// template arguments (raw values with CF fractional bits). The evaluation is
+// Horner's rule in 64-bit; every stage keeps its partial sum in its own Q
+// format, chosen at compile time from the coefficients and the input range:
+//
+//   B_n = |c_n|,  B_k = |c_k| + B_(k+1) * max|x|   (bound on stage k)
+//   Q_k = 61 - (Xb - P) - exponent(B_k)            (|acc_k| < 2^(61 - Xb + P))
+//
+// so no product or stage can overflow, while small partial sums keep as many
+// fractional bits as the width allows. A stage is
+//   acc_k = round((acc_(k+1) * x + c_k) >> shift_k)
+// with the coefficient pre-aligned to the product format: one rounding per
+// stage, all shifts constants. 32-bit x is split into 16-bit halves
+// (P = 16 low bits, whose partial product is truncated by 2^-16 of a stage
+// LSB), which buys the accumulator 16 more bits: partial sums keep about
+// 45 - exponent(B_k) fractional bits for 16- and 32-bit input alike. Per
+// element the stages are straight-line code, so the loop over the array is
+// what the compiler vectorizes (Horner's serial chain only matters within
+// one element).
+
+// 2^n as a double (constexpr; std::ldexp is not)
+constexpr double poly_pow2(int n)
+{
+    double p = 1.0;
+    for (; n > 0; --n) p *= 2.0;
+    for (; n < 0; ++n) p /= 2.0;
+    return p;
+}
+
+// Smallest e with b < 2^e (very negative for b == 0)
+constexpr int poly_exponent(double b)
+{
+    if (b <= 0.0) return -1000;
+    int e = 0;
+    double p = 1.0;
+    while (p <= b) { p *= 2.0; ++e; }
+    while (p / 2.0 > b) { p /= 2.0; --e; }
+    return e;
+}
+
+// round(v / 2^s) half away from zero, or v * 2^-s for s < 0 (constexpr)
+constexpr int64_t poly_align(int64_t v, int s)
+{
+    if (s <= 0) return v * (int64_t(1) << -s);
+    if (s > 62) return 0;
+    int64_t bias = int64_t(1) << (s - 1);
+    return v >= 0 ? (v + bias) >> s : -((-v + bias) >> s);
+}
+
+// Per-stage fractional bits Q_k for Xb-bit input with F fractional bits,
+// P low input bits multiplied separately
+template<int Xb, int F, int P, int CF, size_t N>
+constexpr std::array<int, N> poly_stage_q(const std::array<int64_t, N>& coef)
+{
+    const double x_max = poly_pow2(Xb - F - 1);
+    const double unit = poly_pow2(-CF);
+    std::array<int, N> q{};
+    std::array<int, N> e{};
+    double bound = 0.0;
+    for (size_t i = N; i-- > 0;) {
+        double c = static_cast<double>(coef[i] < 0 ? -coef[i] : coef[i]) * unit;
+        bound = c + bound * x_max;
+        e[i] = poly_exponent(bound * (1.0 + 1e-9));
+        q[i] = 61 - (Xb - P) - e[i];
+        if (q[i] > 62) q[i] = 62;
+    }
+    // The aligned coefficient c_k must fit next to the product:
+    // Q_(k+1) + F - P <= 61 - e_k
+    for (size_t i = 0; i + 1 < N; ++i) {
+        if (q[i + 1] + F - P > 61 - e[i]) q[i + 1] = 61 - e[i] - F + P;
+    }
+    return q;
+}
+
+template<int Xb, int F, int CF, int64_t... C>
+struct PolyPlan {
+    static constexpr size_t terms = sizeof...(C);
+    static constexpr int split = Xb > 16 ? 16 : 0;
+    static constexpr std::array<int64_t, terms> coef{{C...}};
+    static constexpr std::array<int, terms> q = poly_stage_q<Xb, F, split, CF>(coef);
+
+    // c_k at the stage's product format Q(Q_(k+1) + F - split); c_n at Q_n
+    static constexpr std::array<int64_t, terms> aligned = [] {
+        std::array<int64_t, terms> a{};
+        for (size_t k = 0; k + 1 < terms; ++k) a[k] = poly_align(coef[k], CF - (q[k + 1] + F - split));
+        a[terms - 1] = poly_align(coef[terms - 1], CF - q[terms - 1]);
+        return a;
+    }();
+};
+
+// acc * x / 2^P, the low P bits of x in a separate (truncated) product
+template<int P>
+inline int64_t poly_mul(int64_t acc, int64_t x)
+{
+    if constexpr (P == 0) {
+        return acc * x;
+    } else {
+        constexpr int64_t mask = (int64_t(1) << P) - 1;
+        return acc * (x >> P) + ((acc * (x & mask)) >> P);
+    }
+}
+
+template<typename Plan, int F, size_t K>
+inline int64_t poly_stage(int64_t acc, int64_t x)
+{
+    constexpr int shift = Plan::q[K + 1] + F - Plan::split - Plan::q[K];
+    return mixed_align<int64_t, shift>(poly_mul<Plan::split>(acc, x) + Plan::aligned[K]);
+}
+
+// x is unused for a constant polynomial (empty sequence)
+template<typename Plan, int F, size_t... I>
+inline int64_t poly_horner([[maybe_unused]] int64_t x, std::index_sequence<I...>)
+{
+    int64_t acc = Plan::aligned[Plan::terms - 1];
+    ((acc = poly_stage<Plan, F, Plan::terms - 2 - I>(acc, x)), ...);
+    return acc;
+}
+
+template<int Xb, int Ob, int F, int OF, int CF, int64_t... C>
+inline void
+reference_array_poly(const Storage_t<Xb>* x, Storage_t<Ob>* output, size_t length)
+{
+    static_assert(sizeof...(C) > 0, "poly needs at least one coefficient");
+    using Plan = PolyPlan<Xb, F, CF, C...>;
+    using D = Storage_t<Ob>;
+    constexpr int out_shift = Plan::q[0] - OF;
+    static_assert(out_shift > -32, "output format is finer than the polynomial's working precision");
+
+    for (size_t i = 0; i < length; ++i) {
+        int64_t acc = poly_horner<Plan, F>(x[i], std::make_index_sequence<Plan::terms - 1>{});
+        if constexpr (out_shift >= 0) {
+            output[i] = sat_cast<D>(mixed_align<int64_t, out_shift>(acc));
+        } else {
+            // Clamp first so the left shift cannot overflow; the result saturates the same
+            constexpr int64_t lo = (static_cast<int64_t>(std::numeric_limits<D>::min()) >> -out_shift) - 1;
+            constexpr int64_t hi = (static_cast<int64_t>(std::numeric_limits<D>::max()) >> -out_shift) + 1;
+            acc = acc < lo ? lo : acc;
+            acc = acc > hi ? hi : acc;
+            output[i] = sat_cast<D>(acc * (int64_t(1) << -out_shift));
+        }
+    }
+}
+
+} // namespace detail
+} // namespace fp
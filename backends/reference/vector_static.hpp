@@ -0,0 +1,151 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "reduce.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Fixed-Length (FixedArray) Kernels
+// ============================================================================
+//
+// Kernels for arrays whose length N is a template argument. The loop is cut
+// into blocks of STATIC_UNROLL_BYTES that are expanded at compile time (an
+// index_sequence fold, so the unrolling does not depend on compiler
+// heuristics), and the N % block leftover is one more expanded block: no
+// remainder loop, no runtime length, no zero-length check. Arrays of one
+// block or less are unrolled completely.
+//
+// The element arithmetic is branch-free and uses the narrowest intermediate
+// that holds it (32-bit for 8/16-bit data), so the expanded blocks map onto
+// vector instructions. Results are the same as the runtime-length kernels.
+
+// Bytes per expanded block: two 16-byte vectors
+inline constexpr size_t STATIC_UNROLL_BYTES = 32;
+
+template<typename Body, size_t... K>
+inline void static_block(size_t base, Body& body, std::index_sequence<K...>)
+{
+    (body(base + K), ...);
+}
+
+// body(i) for every i in [0, N), U indices per expanded block
+template<size_t N, size_t U, typename Body>
+inline void static_for(Body body)
+{
+    for (size_t base = 0; base < N / U * U; base += U) {
+        static_block(base, body, std::make_index_sequence<U>{});
+    }
+    static_block(N / U * U, body, std::make_index_sequence<N % U>{});
+}
+
+template<int Xb>
+inline constexpr size_t static_unroll = STATIC_UNROLL_BYTES / sizeof(Storage_t<Xb>);
+
+// Intermediate for sums and products of two Xb-bit values
+template<int Xb>
+using StaticWide = std::conditional_t<(sizeof(Storage_t<Xb>) <= 2), int32_t, int64_t>;
+
+template<typename S, typename W>
+inline S static_saturate(W v)
+{
+    constexpr W lo = static_cast<W>(std::numeric_limits<S>::min());
+    constexpr W hi = static_cast<W>(std::numeric_limits<S>::max());
+    v = v < lo ? lo : v;
+    v = v > hi ? hi : v;
+    return static_cast<S>(v);
+}
+
+// round(v / 2^s) half away from zero (s > 0), as round_shift()
+template<typename W>
+inline W static_round_shift(W v, int s)
+{
+    W bias = W(1) << (s - 1);
+    return (v + bias - static_cast<W>(v < 0)) >> s;
+}
+
+template<int Xb, size_t N>
+inline void
+reference_static_elemult(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, Storage_t<Xb>* output,
+                         int frac_bits)
+{
+    using S = Storage_t<Xb>;
+    using W = StaticWide<Xb>;
+    if (frac_bits == 0) {
+        static_for<N, static_unroll<Xb>>([&](size_t i) {
+            output[i] = static_saturate<S>(W(arr1[i]) * W(arr2[i]));
+        });
+        return;
+    }
+    static_for<N, static_unroll<Xb>>([&](size_t i) {
+        output[i] = static_saturate<S>(static_round_shift(W(arr1[i]) * W(arr2[i]), frac_bits));
+    });
+}
+
+template<int Xb, size_t N, bool Subtract>
+inline void
+reference_static_addsub(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, Storage_t<Xb>* output)
+{
+    using S = Storage_t<Xb>;
+    using W = StaticWide<Xb>;
+    static_for<N, static_unroll<Xb>>([&](size_t i) {
+        W a = arr1[i], b = arr2[i];
+        output[i] = static_saturate<S>(Subtract ? a - b : a + b);
+    });
+}
+
+// Same accumulator and single rounding as reference_dot_product
+template<int Xb, size_t N>
+inline Storage_t<Xb>
+reference_static_dot(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, int frac_bits)
+{
+    using Acc = ReduceProductAcc<Xb>;
+    Acc lane[REDUCE_LANES];
+    static_for<N, static_unroll<Xb>>([&](size_t i) {
+        lane[i % REDUCE_LANES].add(static_cast<int64_t>(arr1[i]) * static_cast<int64_t>(arr2[i]));
+    });
+    for (int k = 1; k < REDUCE_LANES; ++k) lane[0].merge(lane[k]);
+    return sat_cast<Storage_t<Xb>>(lane[0].round_shift(frac_bits));
+}
+
+// Left shifts saturate, right shifts are arithmetic (as reference_array_shift)
+template<int Xb, size_t N>
+inline void
+reference_static_shift(Storage_t<Xb>* arr, int shift_amount)
+{
+    using S = Storage_t<Xb>;
+    if (shift_amount > 0) {
+        static_for<N, static_unroll<Xb>>([&](size_t i) {
+            arr[i] = static_saturate<S>(static_cast<int64_t>(arr[i]) * (int64_t(1) << shift_amount));
+        });
+    } else if (shift_amount < 0) {
+        static_for<N, static_unroll<Xb>>([&](size_t i) {
+            arr[i] = static_cast<S>(static_cast<int64_t>(arr[i]) >> -shift_amount);
+        });
+    }
+}
+
+template<int Xb, size_t N>
+inline void
+reference_static_scale(Storage_t<Xb>* arr, Storage_t<Xb> scale_factor, int scale_frac_bits)
+{
+    using S = Storage_t<Xb>;
+    using W = StaticWide<Xb>;
+    if (scale_frac_bits == 0) {
+        static_for<N, static_unroll<Xb>>([&](size_t i) {
+            arr[i] = static_saturate<S>(W(arr[i]) * W(scale_factor));
+        });
+        return;
+    }
+    static_for<N, static_unroll<Xb>>([&](size_t i) {
+        arr[i] = static_saturate<S>(static_round_shift(W(arr[i]) * W(scale_factor), scale_frac_bits));
+    });
+}
+
+} // namespace detail
+} // namespace fp
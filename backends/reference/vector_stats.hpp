@@ -1,7 +1,10 @@
 #pragma once
 #include "../../helpers.hpp"
+#include "isqrt.hpp"
+#include "reduce.hpp"
 #include <cstddef>
-#include <cmath>
+#include <cstdint>
+#include <limits>
 
 namespace fp {
 namespace detail {
@@ -12,23 +15,15 @@ namespace detail {
 //
 // Statistical operations on arrays of fixed-point values.
 
-// Mean: sum of elements / count
+// Mean: sum of elements / count, rounded to nearest
 template<int Xb>
 inline Storage_t<Xb>
 reference_array_mean(const Storage_t<Xb>* arr, size_t length, int frac_bits)
 {
     if (length == 0) return 0;
 
-    // Sum all elements (using wider type to avoid overflow)
-    long long sum = 0;
-    for (size_t i = 0; i < length; ++i) {
-        sum += arr[i];
-    }
-
-    // Divide by length (shift right by log2(length) for power-of-2, or actual divide)
-    // For simplicity, use integer division
-    long long mean = sum / static_cast<long long>(length);
-    return sat_cast<Storage_t<Xb>>(mean);
+    // Exact 64-bit sum from the reduction engine, one rounding in the divide
+    return sat_cast<Storage_t<Xb>>(reduce_sum<Xb>(arr, length).div_round(length));
 }
 
 // RMS (Root Mean Square): sqrt(sum(x^2) / N)
@@ -38,23 +33,184 @@ reference_array_rms(const Storage_t<Xb>* arr, size_t length, int frac_bits)
 {
     if (length == 0) return 0;
 
-    // Sum of squares
-    long long sum_squares = 0;
-    for (size_t i = 0; i < length; ++i) {
-        long long val = arr[i];
-        long long square = (val * val) >> frac_bits;  // Fixed-point square with shift
-        sum_squares += square;
+    // Mean of squares at full precision, Q(2*frac_bits); never exceeds the
+    // largest square, so it fits 64 bits even for 32-bit data
+    int64_t mean_square = reduce_power<Xb>(arr, length).div_round(length);
+
+    // Integer square root back to the input Q format
+    return isqrt_fixed<Storage_t<Xb>>(mean_square, 2 * frac_bits, frac_bits);
+}
+
+// ========== FUSED STATISTICS ==========
+//
+// One pass over the data feeds min/max, an exact sum and an exact sum of
+// squares (reduction engine lanes, see reduce.hpp); every statistic is then
+// derived from those totals with a single rounding. The Mask (fp::stat flags)
+// drops the accumulators no requested field needs.
+//
+// Variance uses the exact identity var = (N * sum(x^2) - sum(x)^2) / N^2,
+// evaluated in 128-bit limb arithmetic (no __int128 on Xtensa), so there is
+// no cancellation error and no second pass around the mean.
+
+template<typename S>
+struct ArrayStatsRaw {
+    S min = 0, max = 0, sum = 0, mean = 0;
+    S power = 0, rms = 0, variance = 0, stddev = 0;
+};
+
+// Unsigned 128-bit value as two 64-bit limbs
+struct U128 {
+    uint64_t hi = 0, lo = 0;
+};
+
+inline U128 u128_mul(uint64_t a, uint64_t b)
+{
+    uint64_t a_lo = a & 0xFFFFFFFFull, a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFFull, b_hi = b >> 32;
+    uint64_t ll = a_lo * b_lo;
+    uint64_t mid1 = a_hi * b_lo;
+    uint64_t mid2 = a_lo * b_hi;
+    uint64_t mid = (ll >> 32) + (mid1 & 0xFFFFFFFFull) + (mid2 & 0xFFFFFFFFull);
+    U128 r;
+    r.lo = (ll & 0xFFFFFFFFull) | (mid << 32);
+    r.hi = a_hi * b_hi + (mid1 >> 32) + (mid2 >> 32) + (mid >> 32);
+    return r;
+}
+
+inline U128 u128_sub(U128 a, U128 b)
+{
+    U128 r;
+    r.lo = a.lo - b.lo;
+    r.hi = a.hi - b.hi - (a.lo < b.lo ? 1 : 0);
+    return r;
+}
+
+// round(a / d) for d > 0 (restoring division); the quotient must fit 64 bits
+inline uint64_t u128_div_round(U128 a, uint64_t d)
+{
+    uint64_t q = 0, rem = 0;
+    for (int bit = 127; bit >= 0; --bit) {
+        uint64_t in = (bit >= 64) ? (a.hi >> (bit - 64)) & 1 : (a.lo >> bit) & 1;
+        bool carry = (rem >> 63) != 0;
+        rem = (rem << 1) | in;
+        q <<= 1;
+        if (carry || rem >= d) {
+            rem -= d;
+            q |= 1;
+        }
     }
+    if (rem >= d - rem) ++q;
+    return q;
+}
+
+// Sum of squares (never negative) as a 128-bit magnitude
+inline U128 stats_power_u128(const ReduceAcc64& acc)
+{
+    U128 r;
+    r.lo = static_cast<uint64_t>(acc.v);
+    return r;
+}
 
-    // Mean of squares
-    long long mean_square = sum_squares / static_cast<long long>(length);
+inline U128 stats_power_u128(const ReduceAccWide& acc)
+{
+    uint64_t mh, ml;
+    acc.magnitude(mh, ml);
+    U128 r;
+    r.hi = mh >> 32;
+    r.lo = (mh << 32) | ml;
+    return r;
+}
+
+// Population variance in Q(2*frac_bits) from the exact totals
+template<typename PowerAcc>
+inline int64_t
+stats_variance_q2f(const ReduceAcc64& sum, const PowerAcc& power, size_t length)
+{
+    uint64_t n = static_cast<uint64_t>(length);
+    U128 p = stats_power_u128(power);
 
-    // Square root (convert to/from float for simplicity in reference implementation)
-    float mean_sq_float = static_cast<float>(mean_square) / static_cast<float>(1u << frac_bits);
-    float rms_float = std::sqrt(mean_sq_float);
-    long long rms_scaled = llroundf(rms_float * static_cast<float>(1u << frac_bits));
+    // N * sum(x^2): p is at most 96 bits, N below 2^32
+    U128 np = u128_mul(n, p.lo);
+    np.hi += n * p.hi;
 
-    return sat_cast<Storage_t<Xb>>(rms_scaled);
+    uint64_t s = (sum.v < 0) ? 0ull - static_cast<uint64_t>(sum.v) : static_cast<uint64_t>(sum.v);
+    U128 num = u128_sub(np, u128_mul(s, s));
+    return static_cast<int64_t>(u128_div_round(num, n * n));
+}
+
+// Accumulator lane for the fused pass
+template<int Xb, unsigned Mask>
+struct StatsAcc {
+    static constexpr bool need_minmax = (Mask & (stat::min | stat::max)) != 0;
+    static constexpr bool need_sum    = (Mask & (stat::sum | stat::mean | stat::variance | stat::stddev)) != 0;
+    static constexpr bool need_power  = (Mask & (stat::power | stat::rms | stat::variance | stat::stddev)) != 0;
+
+    int64_t lo = std::numeric_limits<int64_t>::max();
+    int64_t hi = std::numeric_limits<int64_t>::min();
+    ReduceAcc64 sum;
+    ReduceProductAcc<Xb> power;
+
+    void add(int64_t x) {
+        if constexpr (need_minmax) {
+            lo = (x < lo) ? x : lo;
+            hi = (x > hi) ? x : hi;
+        }
+        if constexpr (need_sum) sum.add(x);
+        if constexpr (need_power) power.add(x * x);
+    }
+
+    void merge(const StatsAcc& other) {
+        if constexpr (need_minmax) {
+            lo = (other.lo < lo) ? other.lo : lo;
+            hi = (other.hi > hi) ? other.hi : hi;
+        }
+        if constexpr (need_sum) sum.merge(other.sum);
+        if constexpr (need_power) power.merge(other.power);
+    }
+
+    void normalize() { power.normalize(); }
+};
+
+// Exact totals of the fused pass; arr is a pointer or a strided accessor
+template<int Xb, unsigned Mask, typename Src>
+inline StatsAcc<Xb, Mask>
+reference_stats_accumulate(Src arr, size_t length)
+{
+    return reduce<StatsAcc<Xb, Mask>>(length, [&](size_t i) { return static_cast<int64_t>(arr[i]); });
+}
+
+// Every field selected by Mask from the totals of length > 0 elements
+template<int Xb, unsigned Mask>
+inline ArrayStatsRaw<Storage_t<Xb>>
+reference_stats_finish(const StatsAcc<Xb, Mask>& acc, size_t length, int frac_bits)
+{
+    using S = Storage_t<Xb>;
+
+    ArrayStatsRaw<S> out;
+    if constexpr ((Mask & stat::min) != 0)   out.min = static_cast<S>(acc.lo);
+    if constexpr ((Mask & stat::max) != 0)   out.max = static_cast<S>(acc.hi);
+    if constexpr ((Mask & stat::sum) != 0)   out.sum = sat_cast<S>(acc.sum.v);
+    if constexpr ((Mask & stat::mean) != 0)  out.mean = sat_cast<S>(acc.sum.div_round(length));
+    if constexpr ((Mask & stat::power) != 0) out.power = sat_cast<S>(acc.power.round_shift(frac_bits));
+    if constexpr ((Mask & stat::rms) != 0) {
+        out.rms = isqrt_fixed<S>(acc.power.div_round(length), 2 * frac_bits, frac_bits);
+    }
+    if constexpr ((Mask & (stat::variance | stat::stddev)) != 0) {
+        int64_t var_q2f = stats_variance_q2f(acc.sum, acc.power, length);
+        out.variance = sat_cast<S>(round_shift(var_q2f, frac_bits));
+        out.stddev = isqrt_fixed<S>(var_q2f, 2 * frac_bits, frac_bits);
+    }
+    return out;
+}
+
+// All statistics selected by Mask in one pass (unselected fields stay 0)
+template<int Xb, unsigned Mask, typename Src>
+inline ArrayStatsRaw<Storage_t<Xb>>
+reference_array_stats(Src arr, size_t length, int frac_bits)
+{
+    if (length == 0) return ArrayStatsRaw<Storage_t<Xb>>{};
+    return reference_stats_finish<Xb, Mask>(reference_stats_accumulate<Xb, Mask>(arr, length),
+                                            length, frac_bits);
 }
 
 // Variance: sum((x - mean)^2) / N
@@ -62,40 +218,15 @@ template<int Xb>
 inline Storage_t<Xb>
 reference_array_variance(const Storage_t<Xb>* arr, size_t length, int frac_bits)
 {
-    if (length == 0) return 0;
-
-    // First compute mean
-    Storage_t<Xb> mean = reference_array_mean<Xb>(arr, length, frac_bits);
-
-    // Sum of squared deviations
-    long long sum_sq_dev = 0;
-    for (size_t i = 0; i < length; ++i) {
-        long long deviation = static_cast<long long>(arr[i]) - static_cast<long long>(mean);
-        long long sq_dev = (deviation * deviation) >> frac_bits;  // Fixed-point square
-        sum_sq_dev += sq_dev;
-    }
-
-    // Divide by N
-    long long variance = sum_sq_dev / static_cast<long long>(length);
-    return sat_cast<Storage_t<Xb>>(variance);
+    return reference_array_stats<Xb, stat::variance>(arr, length, frac_bits).variance;
 }
 
-// Standard deviation: sqrt(variance)
+// Standard deviation: sqrt(variance), from the unrounded Q(2*frac_bits) variance
 template<int Xb>
 inline Storage_t<Xb>
 reference_array_stddev(const Storage_t<Xb>* arr, size_t length, int frac_bits)
 {
-    if (length == 0) return 0;
-
-    // Get variance
-    Storage_t<Xb> variance = reference_array_variance<Xb>(arr, length, frac_bits);
-
-    // Square root (convert to/from float for simplicity)
-    float var_float = static_cast<float>(variance) / static_cast<float>(1u << frac_bits);
-    float stddev_float = std::sqrt(var_float);
-    long long stddev_scaled = llroundf(stddev_float * static_cast<float>(1u << frac_bits));
-
-    return sat_cast<Storage_t<Xb>>(stddev_scaled);
+    return reference_array_stats<Xb, stat::stddev>(arr, length, frac_bits).stddev;
 }
 
 } // namespace detail
@@ -0,0 +1,123 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "reduce.hpp"
+#include "vector_minmax.hpp"
+#include "vector_stats.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Reference Strided Array Kernels
+// ============================================================================
+//
+// Kernels behind StridedArray and MatrixView: element i lives at
+// data[i * stride] (stride in elements, may be negative). Every kernel
+// dispatches on the stride once, outside the loop:
+//   - stride 1 hands the raw pointer to the contiguous loop
+//   - strides 2 and 4 (stereo / quad interleave, every other bin) get a
+//     compile-time stride, so the compiler sees fixed-distance accesses it
+//     can turn into deinterleaving vector loads instead of gathers
+//   - any other stride runs the same loop with a runtime multiply
+// The reductions reuse the reduction-engine and stats kernels through a
+// strided accessor, so results match the contiguous ones bit for bit.
+
+// Indexable view of data[i * stride]; Stride != 0 fixes it at compile time
+template<typename S, ptrdiff_t Stride>
+struct StridedSource {
+    S* data;
+    ptrdiff_t stride;
+
+    // The offset is formed in size_t (wrapping, then converted back), so a
+    // signed overflow of i * stride cannot bound the caller's loop count
+    S& operator[](size_t i) const {
+        return data[static_cast<ptrdiff_t>(i * static_cast<size_t>(Stride != 0 ? Stride : stride))];
+    }
+};
+
+// Call fn with the best accessor for stride; every branch must return the same type
+template<typename S, typename Fn>
+inline decltype(auto) with_stride(S* data, ptrdiff_t stride, Fn&& fn)
+{
+    switch (stride) {
+    case 1:  return fn(data);
+    case 2:  return fn(StridedSource<S, 2>{data, 2});
+    case 4:  return fn(StridedSource<S, 4>{data, 4});
+    default: return fn(StridedSource<S, 0>{data, stride});
+    }
+}
+
+// Strided -> contiguous copy: dst[i] = src[i * stride]
+template<int Xb>
+inline void
+reference_strided_gather(const Storage_t<Xb>* src, ptrdiff_t stride, Storage_t<Xb>* dst, size_t length)
+{
+    with_stride(src, stride, [&](auto in) {
+        for (size_t i = 0; i < length; ++i) dst[i] = in[i];
+    });
+}
+
+// Contiguous -> strided copy: dst[i * stride] = src[i]
+template<int Xb>
+inline void
+reference_strided_scatter(const Storage_t<Xb>* src, Storage_t<Xb>* dst, ptrdiff_t stride, size_t length)
+{
+    with_stride(dst, stride, [&](auto out) {
+        for (size_t i = 0; i < length; ++i) out[i] = src[i];
+    });
+}
+
+template<int Xb>
+inline void
+reference_strided_fill(Storage_t<Xb>* dst, ptrdiff_t stride, size_t length, Storage_t<Xb> value)
+{
+    with_stride(dst, stride, [&](auto out) {
+        for (size_t i = 0; i < length; ++i) out[i] = value;
+    });
+}
+
+// Lazy expression into a strided destination (leaves carry their own strides)
+template<int Xb, typename Expr>
+inline void
+reference_strided_eval(const Expr& expr, Storage_t<Xb>* output, ptrdiff_t stride, size_t length)
+{
+    with_stride(output, stride, [&](auto out) {
+        for (size_t i = 0; i < length; ++i) out[i] = sat_cast<Storage_t<Xb>>(expr[i]);
+    });
+}
+
+template<int Xb, unsigned Mask>
+inline ArrayStatsRaw<Storage_t<Xb>>
+reference_strided_stats(const Storage_t<Xb>* arr, ptrdiff_t stride, size_t length, int frac_bits)
+{
+    return with_stride(arr, stride, [&](auto in) {
+        return reference_array_stats<Xb, Mask>(in, length, frac_bits);
+    });
+}
+
+template<int Xb>
+inline Storage_t<Xb>
+reference_strided_dot(const Storage_t<Xb>* arr1, ptrdiff_t stride1,
+                      const Storage_t<Xb>* arr2, ptrdiff_t stride2, size_t length, int frac_bits)
+{
+    if (length == 0) return 0;
+    return with_stride(arr1, stride1, [&](auto a) {
+        return with_stride(arr2, stride2, [&](auto b) {
+            return sat_cast<Storage_t<Xb>>(reduce_dot<Xb>(a, b, length).round_shift(frac_bits));
+        });
+    });
+}
+
+template<int Xb, bool Max>
+inline size_t
+reference_strided_argext(const Storage_t<Xb>* arr, ptrdiff_t stride, size_t length, Storage_t<Xb>& value)
+{
+    return with_stride(arr, stride, [&](auto in) {
+        return reference_array_argext<Xb, Max>(in, length, value);
+    });
+}
+
+} // namespace detail
+} // namespace fp
@@ -11,6 +11,7 @@ namespace detail {
 // ============================================================================
 //
 // Activation functions use priority_tag dispatch:
+//   - Priority 2: 32-bit Q16.15 sigmoid (NatureDSP scl/vec_sigmoid32x32)
 //   - Priority 1: 16-bit operations (could use NatureDSP optimizations)
 //   - Priority 0: Generic fallback to ReferenceBackend
 //
@@ -50,6 +51,73 @@ xtensa_sigmoid_impl(Storage_t<Xb> ax, int frac_bits, priority_tag<1>)
     return xtensa_sigmoid_impl<Xb>(ax, frac_bits, priority_tag<0>{});
 }
 
+// -------- Priority 2: 32-bit Q16.15 → NatureDSP scl_sigmoid32x32 --------
+// NatureDSP takes Q6.25 and returns Q16.15, so only Q16.15 data maps
+// exactly: the input is widened by 10 bits (saturating; sigmoid is flat there)
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline int32_t
+xtensa_sigmoid_impl(int32_t ax, int frac_bits, priority_tag<2>)
+{
+    if (frac_bits != 15) {
+        return xtensa_sigmoid_impl<Xb>(ax, frac_bits, priority_tag<1>{});
+    }
+    return scl_sigmoid32x32(sat_cast<int32_t>(static_cast<int64_t>(ax) * 1024));
+}
+
+// Forward to Priority 1 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline Storage_t<Xb>
+xtensa_sigmoid_impl(Storage_t<Xb> ax, int frac_bits, priority_tag<2>)
+{
+    return xtensa_sigmoid_impl<Xb>(ax, frac_bits, priority_tag<1>{});
+}
+
+// ========== ARRAY SIGMOID ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb, typename Acc>
+inline void
+xtensa_array_sigmoid_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_sigmoid<Xb, Acc>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit Q16.15 → NatureDSP vec_sigmoid32x32 --------
+// Inputs are rescaled to Q6.25 through a stack block (vec_sigmoid32x32 does
+// not allow x and y to overlap). Cheaper tiers keep the portable kernel.
+
+template<int Xb, typename Acc, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_sigmoid_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    if (frac_bits != 15 || !std::is_same<Acc, precise>::value) {
+        return xtensa_array_sigmoid_impl<Xb, Acc>(input, output, length, frac_bits, priority_tag<0>{});
+    }
+
+    constexpr size_t block = 64;
+    int32_t x_q25[block];
+    for (size_t i = 0; i < length; i += block) {
+        size_t n = (length - i < block) ? (length - i) : block;
+        for (size_t k = 0; k < n; ++k) {
+            x_q25[k] = sat_cast<int32_t>(static_cast<int64_t>(input[i + k]) * 1024);
+        }
+        vec_sigmoid32x32(output + i, x_q25, static_cast<int>(n));
+    }
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, typename Acc, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_sigmoid_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_sigmoid_impl<Xb, Acc>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
 // ========== RELU ==========
 
 // -------- Priority 0: Generic Fallback → ReferenceBackend --------
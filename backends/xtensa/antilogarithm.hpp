@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
 #include "../reference/backend.hpp"
+#include <cstddef>
 
 namespace fp {
 namespace detail {
@@ -112,5 +113,113 @@ xtensa_antilog10_impl(Storage_t<Xb> ax, int frac_bits, priority_tag<1>)
     return xtensa_antilog10_impl<Xb>(ax, frac_bits, priority_tag<0>{});
 }
 
+// ========== 2^x between arbitrary Q formats ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+// NatureDSP only consumes Q6.25; arbitrary formats use the portable kernel
+
+template<int Xb, int Ob, typename Acc>
+inline Storage_t<Ob>
+xtensa_exp2_q_impl(Storage_t<Xb> ax, int in_frac_bits, int out_frac_bits, priority_tag<0>)
+{
+    return ReferenceBackend::template exp2_q<Xb, Ob, Acc>(ax, in_frac_bits, out_frac_bits);
+}
+
+// ========== ARRAY ANTILOG2 ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_antilog2_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_antilog2<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_antilog2_32x32 --------
+// Q6.25 in, Q16.15 out, the same convention as the scalar op (no overlap)
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_antilog2_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    vec_antilog2_32x32(output, input, static_cast<int>(length));
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_antilog2_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_antilog2_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
+// ========== ARRAY ANTILOGN ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_antilogn_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_antilogn<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_antilogn_32x32 --------
+// Q6.25 in, Q16.15 out, the same convention as the scalar op (no overlap)
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_antilogn_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    vec_antilogn_32x32(output, input, static_cast<int>(length));
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_antilogn_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_antilogn_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
+// ========== ARRAY ANTILOG10 ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_antilog10_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_antilog10<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_antilog10_32x32 --------
+// Q6.25 in, Q16.15 out, the same convention as the scalar op (no overlap)
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_antilog10_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    vec_antilog10_32x32(output, input, static_cast<int>(length));
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_antilog10_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_antilog10_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
 } // namespace detail
 } // namespace fp
@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
 #include "../reference/backend.hpp"
+#include <cstddef>
 
 namespace fp {
 namespace detail {
@@ -132,5 +133,51 @@ xtensa_div_impl( typename StorageForBits<Xb>::type ax,
     return xtensa_div_impl<Xb, Yb, Ob>(ax, by, out_frac_shift, priority_tag<1>{});
 }
 
+// ========== ARRAY RECIPROCAL ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_recip_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                        size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_recip<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_recip32x32 --------
+// NatureDSP returns mantissa (Q31) and exponent of 1/x for Q31 x. For data
+// with F fractional bits: 1/x = mant * 2^(2F - 62 + exp) in the same format
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_recip_impl(const int32_t* input, int32_t* output,
+                        size_t length, int frac_bits, priority_tag<1>)
+{
+    constexpr size_t block = 64;
+    int32_t mant[block];
+    int16_t expo[block];
+    for (size_t i = 0; i < length; i += block) {
+        size_t n = (length - i < block) ? (length - i) : block;
+        vec_recip32x32(mant, expo, input + i, static_cast<int>(n));
+        for (size_t k = 0; k < n; ++k) {
+            int shift = 62 - 2 * frac_bits - expo[k];
+            output[i + k] = (shift <= -32)
+                ? ((mant[k] < 0) ? std::numeric_limits<int32_t>::min()
+                                 : std::numeric_limits<int32_t>::max())
+                : sat_cast<int32_t>(round_shift(mant[k], shift));
+        }
+    }
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_recip_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                        size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_recip_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
 } // namespace detail
 } // namespace fp
@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
 #include "../reference/backend.hpp"
+#include <cstddef>
 
 namespace fp {
 namespace detail {
@@ -112,5 +113,122 @@ xtensa_log10_impl(typename StorageForBits<Xb>::type ax, int frac_bits, priority_
     return xtensa_log10_impl<Xb>(ax, frac_bits, priority_tag<0>{});
 }
 
+// ========== LOG2 into arbitrary Q format ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+// NatureDSP only produces Q6.25; arbitrary output formats use the portable kernel
+
+template<int Xb, int Ob, typename Acc>
+inline Storage_t<Ob>
+xtensa_log2_q_impl(Storage_t<Xb> ax, int in_frac_bits, int out_frac_bits, priority_tag<0>)
+{
+    return ReferenceBackend::template log2_q<Xb, Ob, Acc>(ax, in_frac_bits, out_frac_bits);
+}
+
+// ========== ARRAY LOG2 ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_log2_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_log2<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_log2_32x32 --------
+// Q16.15 in, Q6.25 out: only Q16.15 data maps exactly (x, y must not overlap)
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_log2_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    if (frac_bits != 15) {
+        return xtensa_array_log2_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+    }
+    vec_log2_32x32(output, input, static_cast<int>(length));
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_log2_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_log2_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
+// ========== ARRAY LOGN ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_logn_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_logn<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_logn_32x32 --------
+// Q16.15 in, Q6.25 out: only Q16.15 data maps exactly (x, y must not overlap)
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_logn_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    if (frac_bits != 15) {
+        return xtensa_array_logn_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+    }
+    vec_logn_32x32(output, input, static_cast<int>(length));
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_logn_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_logn_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
+// ========== ARRAY LOG10 ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_log10_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_log10<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_log10_32x32 --------
+// Q16.15 in, Q6.25 out: only Q16.15 data maps exactly (x, y must not overlap)
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_log10_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    if (frac_bits != 15) {
+        return xtensa_array_log10_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+    }
+    vec_log10_32x32(output, input, static_cast<int>(length));
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_log10_impl(const Storage_t<Xb>* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_log10_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
 } // namespace detail
 } // namespace fp
@@ -11,16 +11,18 @@ namespace detail {
 //
 // This implementation uses priority_tag dispatch to select specialized
 // rsqrt paths based on operand bucket size:
-//   - Priority 2: 32-bit (uses NatureDSP scl_rsqrt32x32)
-//   - Priority 1: 16-bit (uses NatureDSP scl_rsqrt16x16)
+//   - Priority 2: 32-bit
+//   - Priority 1: 16-bit
 //   - Priority 0: Generic fallback to ReferenceBackend
 //
 // Note: All implementations must be defined in reverse priority order (Priority 0 first,
 // then Priority 1, then Priority 2) so that each level can call the next without forward declarations.
 //
-// NatureDSP variants:
-//   - scl_rsqrt32x32: 32-bit reciprocal square root with 1 LSB mantissa accuracy
-//   - scl_rsqrt16x16: 16-bit reciprocal square root with 1 LSB mantissa accuracy
+// Every bucket runs the integer kernel (within 1 LSB of Qx.F). NatureDSP's
+// scl_rsqrt32x32 / scl_rsqrt16x16 are not used: they read the input as
+// Q31 / Q15 and return a packed mantissa/exponent pair, so another Q format
+// needs a sqrt(2) correction whenever (31 - F) is odd, and the 32-bit
+// mantissa is only accurate to 2.4e-7, well short of a Q31 LSB.
 //
 // Input and output are in the same Q format.
 
@@ -47,19 +49,7 @@ template<int Xb,
 inline int16_t
 xtensa_rsqrt_impl(int16_t ax, int frac_bits, priority_tag<1>)
 {
-    // TODO: Use NatureDSP scl_rsqrt16x16 when available
-    // For now, use portable implementation
-
-    if (ax <= 0) {
-        return std::numeric_limits<int16_t>::min();
-    }
-
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
-    float result = 1.0f / std::sqrt(x);
-    float scale = static_cast<float>(1u << frac_bits);
-    long long result_scaled = llroundf(result * scale);
-
-    return sat_cast<int16_t>(result_scaled);
+    return xtensa_rsqrt_impl<Xb>(ax, frac_bits, priority_tag<0>{});
 }
 
 // Forward to Priority 0 when NOT 16-bit
@@ -84,19 +74,7 @@ template<int Xb,
 inline int32_t
 xtensa_rsqrt_impl(int32_t ax, int frac_bits, priority_tag<2>)
 {
-    // TODO: Use NatureDSP scl_rsqrt32x32 when available
-    // For now, use portable implementation
-
-    if (ax <= 0) {
-        return std::numeric_limits<int32_t>::min();
-    }
-
-    float x = static_cast<float>(ax) / static_cast<float>(1u << frac_bits);
-    float result = 1.0f / std::sqrt(x);
-    float scale = static_cast<float>(1u << frac_bits);
-    long long result_scaled = llroundf(result * scale);
-
-    return sat_cast<int32_t>(result_scaled);
+    return xtensa_rsqrt_impl<Xb>(ax, frac_bits, priority_tag<1>{});
 }
 
 // Forward to Priority 1 when NOT 32-bit
@@ -110,5 +88,19 @@ xtensa_rsqrt_impl(typename StorageForBits<Xb>::type ax,
     return xtensa_rsqrt_impl<Xb>(ax, frac_bits, priority_tag<1>{});
 }
 
+// ========== ARRAY RSQRT ==========
+
+// NatureDSP vec_rsqrt16x16/32x32 return mantissa/exponent pairs rather than
+// same-format output, so every bucket uses the integer kernel. The backend's
+// priority_tag<2> argument converts to this single overload.
+
+template<int Xb>
+inline void
+xtensa_array_rsqrt_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                        size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_rsqrt<Xb>(input, output, length, frac_bits);
+}
+
 } // namespace detail
 } // namespace fp
@@ -1,6 +1,8 @@
 #pragma once
 #include "../../helpers.hpp"
 #include "../reference/backend.hpp"
+#include "vector_helpers.hpp"
+#include <cstddef>
 
 namespace fp {
 namespace detail {
@@ -12,7 +14,13 @@ namespace detail {
 // Square root functions use NatureDSP library functions:
 //   - Priority 2: 32-bit operations (uses NatureDSP scl_sqrt32x32, etc.)
 //   - Priority 1: 16-bit operations (uses NatureDSP scl_sqrt16x16, etc.)
-//   - Priority 0: Generic fallback to ReferenceBackend
+//   - Priority 0: Generic fallback to ReferenceBackend (integer table+Newton kernel)
+//
+// NatureDSP array/wide variants used:
+//   - vec_sqrt16x16: Q15 in, Q15 out (only exact for frac_bits == 15)
+//   - vec_sqrt32x32, vec_sqrt32x32_fast: Q31 in, Q31 out (frac_bits == 31)
+//     (_fast requires 8-byte alignment and even N)
+//   - scl_sqrt64x32: Q63 in, Q31 out, i.e. any format pair with 2*out_frac - in_frac == -1
 //
 // Note: All implementations must be defined in reverse priority order.
 
@@ -71,5 +79,96 @@ xtensa_sqrt_impl(typename StorageForBits<Xb>::type ax, int frac_bits, priority_t
     return xtensa_sqrt_impl<Xb>(ax, frac_bits, priority_tag<1>{});
 }
 
+// ========== ARRAY SQRT ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_sqrt_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_sqrt<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 16-bit Specialization --------
+
+template<int Xb, EnableIf<is_16bit<Xb>::value> = 0>
+inline void
+xtensa_array_sqrt_impl(const int16_t* input, int16_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    // vec_sqrt16x16 computes sqrt in Q15, which only matches Q1.15 data
+    if (frac_bits != 15) {
+        return xtensa_array_sqrt_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+    }
+    vec_sqrt16x16(output, input, static_cast<int>(length));
+}
+
+template<int Xb, EnableIf<!is_16bit<Xb>::value> = 0>
+inline void
+xtensa_array_sqrt_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_sqrt_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
+// -------- Priority 2: 32-bit Specialization --------
+
+template<int Xb, EnableIf<is_32bit<Xb>::value> = 0>
+inline void
+xtensa_array_sqrt_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<2>)
+{
+    // vec_sqrt32x32 computes sqrt in Q31, which only matches Q1.31 data
+    if (frac_bits != 31) {
+        return xtensa_array_sqrt_impl<Xb>(input, output, length, frac_bits, priority_tag<1>{});
+    }
+    if (can_use_fast_variant(input, output, length)) {
+        vec_sqrt32x32_fast(output, input, static_cast<int>(length));
+    } else {
+        vec_sqrt32x32(output, input, static_cast<int>(length));
+    }
+}
+
+template<int Xb, EnableIf<!is_32bit<Xb>::value> = 0>
+inline void
+xtensa_array_sqrt_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<2>)
+{
+    xtensa_array_sqrt_impl<Xb>(input, output, length, frac_bits, priority_tag<1>{});
+}
+
+// ========== WIDE (64-bit input) SQRT ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Ob>
+inline Storage_t<Ob>
+xtensa_sqrt64_impl(int64_t x, int in_frac_bits, int out_frac_bits, priority_tag<0>)
+{
+    return ReferenceBackend::template sqrt64<Ob>(x, in_frac_bits, out_frac_bits);
+}
+
+// -------- Priority 1: 32-bit output → scl_sqrt64x32 --------
+
+template<int Ob, EnableIf<is_32bit<Ob>::value> = 0>
+inline int32_t
+xtensa_sqrt64_impl(int64_t x, int in_frac_bits, int out_frac_bits, priority_tag<1>)
+{
+    // scl_sqrt64x32 maps Q63 to Q31: sqrt(x * 2^-1) in raw units
+    if (2 * out_frac_bits - in_frac_bits != -1) {
+        return xtensa_sqrt64_impl<Ob>(x, in_frac_bits, out_frac_bits, priority_tag<0>{});
+    }
+    return scl_sqrt64x32(x);
+}
+
+template<int Ob, EnableIf<!is_32bit<Ob>::value> = 0>
+inline Storage_t<Ob>
+xtensa_sqrt64_impl(int64_t x, int in_frac_bits, int out_frac_bits, priority_tag<1>)
+{
+    return xtensa_sqrt64_impl<Ob>(x, in_frac_bits, out_frac_bits, priority_tag<0>{});
+}
+
 } // namespace detail
 } // namespace fp
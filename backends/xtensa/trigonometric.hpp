@@ -1,6 +1,8 @@
 #pragma once
 #include "../../helpers.hpp"
 #include "../reference/backend.hpp"
+#include "vector_helpers.hpp"
+#include <cstddef>
 
 namespace fp {
 namespace detail {
@@ -142,5 +144,152 @@ xtensa_atan_impl(Storage_t<Xb> ax, int frac_bits, priority_tag<1>)
     return xtensa_atan_impl<Xb>(ax, frac_bits, priority_tag<0>{});
 }
 
+// x radians (frac_bits) -> x/pi in Q31 half turns, wrapped modulo 2
+inline int32_t
+xtensa_radians_to_q31_turns(int32_t x, int frac_bits)
+{
+    constexpr int64_t Q61_INV_PI = 733972625820500307;
+    int64_t turns = mul_shift_sat(x, Q61_INV_PI, frac_bits + 30);
+    return static_cast<int32_t>(static_cast<uint32_t>(turns));
+}
+
+// ========== ARRAY SIN ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_sin_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_sin<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_sine32x32 --------
+// NatureDSP evaluates sin(pi*x) for Q31 x: radians are mapped to Q31 half
+// turns (wrapping is exact, the period is 2) through an aligned stack block,
+// so every full block takes the _fast variant
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_sin_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    constexpr size_t block = 64;
+    alignas(8) int32_t phase[block];
+    alignas(8) int32_t y[block];
+    for (size_t i = 0; i < length; i += block) {
+        size_t n = (length - i < block) ? (length - i) : block;
+        for (size_t k = 0; k < n; ++k) {
+            phase[k] = xtensa_radians_to_q31_turns(input[i + k], frac_bits);
+        }
+        if (can_use_fast_variant(phase, y, n)) {
+            vec_sine32x32_fast(y, phase, static_cast<int>(n));
+        } else {
+            vec_sine32x32(y, phase, static_cast<int>(n));
+        }
+        for (size_t k = 0; k < n; ++k) {
+            output[i + k] = sat_cast<int32_t>(round_shift(y[k], 31 - frac_bits));
+        }
+    }
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_sin_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_sin_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
+// ========== ARRAY COS ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_cos_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_cos<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit → NatureDSP vec_cosine32x32 --------
+// NatureDSP evaluates cos(pi*x) for Q31 x: radians are mapped to Q31 half
+// turns (wrapping is exact, the period is 2) through an aligned stack block,
+// so every full block takes the _fast variant
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_cos_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    constexpr size_t block = 64;
+    alignas(8) int32_t phase[block];
+    alignas(8) int32_t y[block];
+    for (size_t i = 0; i < length; i += block) {
+        size_t n = (length - i < block) ? (length - i) : block;
+        for (size_t k = 0; k < n; ++k) {
+            phase[k] = xtensa_radians_to_q31_turns(input[i + k], frac_bits);
+        }
+        if (can_use_fast_variant(phase, y, n)) {
+            vec_cosine32x32_fast(y, phase, static_cast<int>(n));
+        } else {
+            vec_cosine32x32(y, phase, static_cast<int>(n));
+        }
+        for (size_t k = 0; k < n; ++k) {
+            output[i + k] = sat_cast<int32_t>(round_shift(y[k], 31 - frac_bits));
+        }
+    }
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_cos_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_cos_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
+// ========== ARRAY ATAN ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_atan_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_atan<Xb>(input, output, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit Q1.31 → NatureDSP vec_atan32x32 --------
+// NatureDSP returns atan(x)/pi in Q31; rescale by pi in place
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_atan_impl(const int32_t* input, int32_t* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    if (frac_bits != 31) {
+        return xtensa_array_atan_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+    }
+    vec_atan32x32(output, input, static_cast<int>(length));
+    for (size_t i = 0; i < length; ++i) {
+        output[i] = sat_cast<int32_t>(mul_shift_sat(output[i], Q30_PI_2, 29));
+    }
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_atan_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output,
+                       size_t length, int frac_bits, priority_tag<1>)
+{
+    xtensa_array_atan_impl<Xb>(input, output, length, frac_bits, priority_tag<0>{});
+}
+
 } // namespace detail
 } // namespace fp
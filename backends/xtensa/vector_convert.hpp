@@ -0,0 +1,77 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "../reference/backend.hpp"
+#include "vector_helpers.hpp"
+#include <cstddef>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Xtensa Q-Format Conversion Implementation with Priority Dispatch
+// ============================================================================
+//
+// NatureDSP functions used:
+//   - vec_shift16x16, vec_shift32x32: left shift with saturation
+//   - vec_shift16x16_fast, vec_shift32x32_fast: Fast variants (8-byte aligned, N%4==0)
+//   - Note: their right shifts truncate, and there are no cross-bucket
+//     (8 <-> 16 <-> 32) conversions
+//
+// Array convert operations use priority_tag dispatch:
+//   - Priority 1: widening shift within the 16- or 32-bit bucket (NatureDSP)
+//   - Priority 0: Generic fallback to ReferenceBackend (rounding right shifts,
+//     cross-bucket pack/unpack)
+//
+// Note: All implementations must be defined in reverse priority order.
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb, int Yb, int Shift>
+inline void
+xtensa_array_convert_impl(const Storage_t<Xb>* in, Storage_t<Yb>* out, size_t length, priority_tag<0>)
+{
+    ReferenceBackend::template array_convert<Xb, Yb, Shift>(in, out, length);
+}
+
+// -------- Priority 1: Same-Bucket Left Shift --------
+
+template<int Xb, int Yb, int Shift>
+using is_bucket_shift = std::integral_constant<bool,
+    (BucketBits<Xb>::value == BucketBits<Yb>::value) && (BucketBits<Xb>::value >= 16) && (Shift > 0)>;
+
+// Enabled for a left shift within the 16- or 32-bit bucket
+template<int Xb, int Yb, int Shift, EnableIf<is_bucket_shift<Xb, Yb, Shift>::value> = 0>
+inline void
+xtensa_array_convert_impl(const Storage_t<Xb>* in, Storage_t<Yb>* out, size_t length, priority_tag<1>)
+{
+    // vec_shift*: x and y must not overlap
+    if (in == out) {
+        return xtensa_array_convert_impl<Xb, Yb, Shift>(in, out, length, priority_tag<0>{});
+    }
+
+    const int n = static_cast<int>(length);
+    if constexpr (IsBucket<Xb, 16>::value) {
+        if (can_use_fast_variant(in, out, length)) {
+            vec_shift16x16_fast(out, in, Shift, n);
+        } else {
+            vec_shift16x16(out, in, Shift, n);
+        }
+    } else {
+        if (can_use_fast_variant(in, out, length)) {
+            vec_shift32x32_fast(out, in, Shift, n);
+        } else {
+            vec_shift32x32(out, in, Shift, n);
+        }
+    }
+}
+
+// Forward to Priority 0 otherwise
+template<int Xb, int Yb, int Shift, EnableIf<!is_bucket_shift<Xb, Yb, Shift>::value> = 0>
+inline void
+xtensa_array_convert_impl(const Storage_t<Xb>* in, Storage_t<Yb>* out, size_t length, priority_tag<1>)
+{
+    return xtensa_array_convert_impl<Xb, Yb, Shift>(in, out, length, priority_tag<0>{});
+}
+
+} // namespace detail
+} // namespace fp
@@ -111,27 +111,27 @@ xtensa_array_elemult_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
 
 // -------- Priority 0: Generic Fallback → ReferenceBackend --------
 
-template<int Xb>
+template<int Xb, typename L>
 inline void
 xtensa_array_add_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
-                      Storage_t<Xb>* output, size_t length, priority_tag<0>)
+                      Storage_t<Xb>* output, size_t length, L layout, priority_tag<0>)
 {
-    return detail::reference_array_add<Xb>(arr1, arr2, output, length);
+    return ReferenceBackend::template array_add<Xb>(arr1, arr2, output, length, layout);
 }
 
 // -------- Priority 1: 16-bit Specialization --------
 
-template<int Xb, EnableIf<is_16bit<Xb>::value> = 0>
+template<int Xb, typename L, EnableIf<is_16bit<Xb>::value> = 0>
 inline void
 xtensa_array_add_impl(const int16_t* arr1, const int16_t* arr2,
-                      int16_t* output, size_t length, priority_tag<1>)
+                      int16_t* output, size_t length, L layout, priority_tag<1>)
 {
     // Use NatureDSP vec_add16x16
     // vec_add16x16: void vec_add16x16(int16_t *z, const int16_t *x, const int16_t *y, int N)
     // vec_add16x16_fast: void vec_add16x16_fast(int16_t *z, const int16_t *x, const int16_t *y, int N)
     //   - Requires 8-byte alignment and N%4==0
     // Performs: z[i] = x[i] + y[i] with saturation
-    if (can_use_fast_variant(arr1, arr2, output, length)) {
+    if (can_use_fast_variant(layout, arr1, arr2, output, length)) {
         // Use fast variant
         vec_add16x16_fast(output, arr1, arr2, static_cast<int>(length));
     } else {
@@ -140,27 +140,27 @@ xtensa_array_add_impl(const int16_t* arr1, const int16_t* arr2,
     }
 }
 
-template<int Xb, EnableIf<!is_16bit<Xb>::value> = 0>
+template<int Xb, typename L, EnableIf<!is_16bit<Xb>::value> = 0>
 inline void
 xtensa_array_add_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
-                      Storage_t<Xb>* output, size_t length, priority_tag<1>)
+                      Storage_t<Xb>* output, size_t length, L layout, priority_tag<1>)
 {
-    return xtensa_array_add_impl<Xb>(arr1, arr2, output, length, priority_tag<0>{});
+    return xtensa_array_add_impl<Xb>(arr1, arr2, output, length, layout, priority_tag<0>{});
 }
 
 // -------- Priority 2: 32-bit and 8-bit Specializations --------
 
-template<int Xb, EnableIf<is_32bit<Xb>::value> = 0>
+template<int Xb, typename L, EnableIf<is_32bit<Xb>::value> = 0>
 inline void
 xtensa_array_add_impl(const int32_t* arr1, const int32_t* arr2,
-                      int32_t* output, size_t length, priority_tag<2>)
+                      int32_t* output, size_t length, L layout, priority_tag<2>)
 {
     // Use NatureDSP vec_add32x32
     // vec_add32x32: void vec_add32x32(int32_t *z, const int32_t *x, const int32_t *y, int N)
     // vec_add32x32_fast: void vec_add32x32_fast(int32_t *z, const int32_t *x, const int32_t *y, int N)
     //   - Requires 8-byte alignment and N%4==0
     // Performs: z[i] = x[i] + y[i] with saturation
-    if (can_use_fast_variant(arr1, arr2, output, length)) {
+    if (can_use_fast_variant(layout, arr1, arr2, output, length)) {
         // Use fast variant
         vec_add32x32_fast(output, arr1, arr2, static_cast<int>(length));
     } else {
@@ -169,21 +169,21 @@ xtensa_array_add_impl(const int32_t* arr1, const int32_t* arr2,
     }
 }
 
-template<int Xb, EnableIf<is_8bit<Xb>::value> = 0>
+template<int Xb, typename L, EnableIf<is_8bit<Xb>::value> = 0>
 inline void
 xtensa_array_add_impl(const int8_t* arr1, const int8_t* arr2,
-                      int8_t* output, size_t length, priority_tag<2>)
+                      int8_t* output, size_t length, L layout, priority_tag<2>)
 {
     // NatureDSP doesn't have vec_add8x8 - use reference implementation
-    return xtensa_array_add_impl<Xb>(arr1, arr2, output, length, priority_tag<1>{});
+    return xtensa_array_add_impl<Xb>(arr1, arr2, output, length, layout, priority_tag<1>{});
 }
 
-template<int Xb, EnableIf<!is_32bit<Xb>::value && !is_8bit<Xb>::value> = 0>
+template<int Xb, typename L, EnableIf<!is_32bit<Xb>::value && !is_8bit<Xb>::value> = 0>
 inline void
 xtensa_array_add_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
-                      Storage_t<Xb>* output, size_t length, priority_tag<2>)
+                      Storage_t<Xb>* output, size_t length, L layout, priority_tag<2>)
 {
-    return xtensa_array_add_impl<Xb>(arr1, arr2, output, length, priority_tag<1>{});
+    return xtensa_array_add_impl<Xb>(arr1, arr2, output, length, layout, priority_tag<1>{});
 }
 
 // ========== ELEMENT-WISE SUBTRACT ==========
@@ -249,5 +249,19 @@ xtensa_array_sub_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
     return xtensa_array_sub_impl<Xb>(arr1, arr2, output, length, priority_tag<1>{});
 }
 
+// ========== FUSED EXPRESSION EVALUATION ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+// NatureDSP has no fused element-wise kernels; the reference loop is plain
+// scalar C with min/max saturation, left to the compiler's auto-vectorizer
+
+template<int Xb, typename Expr>
+inline void
+xtensa_array_eval_impl(const Expr& expr, Storage_t<Xb>* output, size_t length,
+                       priority_tag<0>)
+{
+    return detail::reference_array_eval<Xb>(expr, output, length);
+}
+
 } // namespace detail
 } // namespace fp
@@ -0,0 +1,55 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "../reference/backend.hpp"
+#include <cstddef>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Xtensa Float <-> Fixed Bulk Conversion Implementation with Priority Dispatch
+// ============================================================================
+//
+// NatureDSP functions used:
+//   - vec_int2float: int32 -> float scaled by 2^t (exact power-of-two scale,
+//     same values as the reference kernel)
+//   - Note: vec_float2int truncates toward zero, while FixedPoint(float)
+//     rounds to nearest, so float -> fixed stays on the reference kernel;
+//     no 8/16-bit variants exist
+//
+// Array float conversions use priority_tag dispatch:
+//   - Priority 1: 32-bit fixed -> float (NatureDSP)
+//   - Priority 0: Generic fallback to ReferenceBackend
+//
+// Note: All implementations must be defined in reverse priority order.
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_to_float_impl(const Storage_t<Xb>* in, float* out, size_t length, int frac_bits, priority_tag<0>)
+{
+    ReferenceBackend::template array_to_float<Xb>(in, out, length, frac_bits);
+}
+
+// -------- Priority 1: 32-bit Specialization --------
+
+// Enabled when 32-bit
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_to_float_impl(const int32_t* in, float* out, size_t length, int frac_bits, priority_tag<1>)
+{
+    // NatureDSP vec_int2float: void vec_int2float(float32_t *y, const int32_t *x, int t, int N)
+    vec_int2float(out, in, -frac_bits, static_cast<int>(length));
+}
+
+// Forward to Priority 0 when NOT 32-bit
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_to_float_impl(const Storage_t<Xb>* in, float* out, size_t length, int frac_bits, priority_tag<1>)
+{
+    return xtensa_array_to_float_impl<Xb>(in, out, length, frac_bits, priority_tag<0>{});
+}
+
+} // namespace detail
+} // namespace fp
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstddef>
 #include <cstdint>
+#include "../../helpers.hpp"
 
 namespace fp {
 namespace detail {
@@ -34,5 +35,45 @@ inline bool can_use_fast_variant(T* ptr, size_t length) {
     return ((reinterpret_cast<uintptr_t>(ptr) & 7) == 0);
 }
 
+// Layout-tagged versions: when the view type already guarantees 8-byte
+// alignment and N % 4 == 0 the answer is a compile-time constant and the
+// pointer checks disappear; otherwise they fall back to the runtime test
+template<size_t Align, size_t Mult>
+inline constexpr bool layout_allows_fast = (Align % 8 == 0) && (Mult % 4 == 0);
+
+template<size_t Align, size_t Mult, typename T>
+inline bool can_use_fast_variant(Layout<Align, Mult>, const T* ptr1, const T* ptr2, size_t length) {
+    if constexpr (layout_allows_fast<Align, Mult>) return true;
+    else return can_use_fast_variant(ptr1, ptr2, length);
+}
+
+template<size_t Align, size_t Mult, typename T>
+inline bool can_use_fast_variant(Layout<Align, Mult>, const T* ptr1, const T* ptr2, T* ptr3, size_t length) {
+    if constexpr (layout_allows_fast<Align, Mult>) return true;
+    else return can_use_fast_variant(ptr1, ptr2, ptr3, length);
+}
+
+template<size_t Align, size_t Mult, typename T>
+inline bool can_use_fast_variant(Layout<Align, Mult>, T* ptr, size_t length) {
+    if constexpr (layout_allows_fast<Align, Mult>) return true;
+    else return can_use_fast_variant(ptr, length);
+}
+
+// Every pointer 8-byte aligned, any length: for NatureDSP kernels without a
+// _fast variant whose 64-bit loads still require aligned input
+// (vec_eleabs*, vec_elemax*, vec_elemin*)
+template<typename... T>
+inline bool all_aligned_8(const T*... ptrs) {
+    return (((reinterpret_cast<uintptr_t>(ptrs) & 7) == 0) && ...);
+}
+
+// True when [a, a + na) and [b, b + nb) share any byte: for NatureDSP kernels
+// that forbid overlapping input and output, not just identical pointers
+template<typename A, typename B>
+inline bool ranges_overlap(const A* a, size_t na, const B* b, size_t nb) {
+    const uintptr_t a0 = reinterpret_cast<uintptr_t>(a), b0 = reinterpret_cast<uintptr_t>(b);
+    return a0 < b0 + nb * sizeof(B) && b0 < a0 + na * sizeof(A);
+}
+
 } // namespace detail
 } // namespace fp
@@ -1,6 +1,7 @@
 #pragma once
 #include "../../helpers.hpp"
 #include "../reference/backend.hpp"
+#include "vector_helpers.hpp"
 #include <cstddef>
 
 namespace fp {
@@ -10,6 +11,12 @@ namespace detail {
 // Xtensa Vector Min/Max Implementation with Priority Dispatch
 // ============================================================================
 //
+// Element-wise max/min/abs map to NatureDSP vec_elemax*, vec_elemin* and
+// vec_eleabs* (16/32-bit) when every pointer is 8-byte aligned (their
+// 64-bit loads require it; offset slices and strided rows often are not)
+// and to the reference loops otherwise. Clip, threshold and select have no
+// NatureDSP counterpart and use the reference compare/select loops.
+//
 // Array min/max operations use priority_tag dispatch:
 //   - Priority 2: 8-bit arrays (could use NatureDSP vec_min8/max8)
 //   - Priority 1: 16-bit arrays (could use NatureDSP vec_min16/max16)
@@ -125,5 +132,165 @@ xtensa_array_max_impl(const Storage_t<Xb>* arr, size_t length, priority_tag<2>)
     return xtensa_array_max_impl<Xb>(arr, length, priority_tag<1>{});
 }
 
+// ========== ELEMENT-WISE MAX ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_elemax_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                         Storage_t<Xb>* output, size_t length, priority_tag<0>)
+{
+    ReferenceBackend::template array_elemax<Xb>(arr1, arr2, output, length);
+}
+
+// -------- Priority 1: 16-bit Specialization --------
+
+template<int Xb, EnableIf<is_16bit<Xb>::value> = 0>
+inline void
+xtensa_array_elemax_impl(const int16_t* arr1, const int16_t* arr2,
+                         int16_t* output, size_t length, priority_tag<1>)
+{
+    if (!all_aligned_8(arr1, arr2, output)) {
+        return xtensa_array_elemax_impl<Xb>(arr1, arr2, output, length, priority_tag<0>{});
+    }
+    vec_elemax16x16(output, const_cast<int16_t*>(arr1), const_cast<int16_t*>(arr2), static_cast<int>(length));
+}
+
+template<int Xb, EnableIf<!is_16bit<Xb>::value> = 0>
+inline void
+xtensa_array_elemax_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                         Storage_t<Xb>* output, size_t length, priority_tag<1>)
+{
+    xtensa_array_elemax_impl<Xb>(arr1, arr2, output, length, priority_tag<0>{});
+}
+
+// -------- Priority 2: 32-bit Specialization --------
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_elemax_impl(const int32_t* arr1, const int32_t* arr2,
+                         int32_t* output, size_t length, priority_tag<2>)
+{
+    if (!all_aligned_8(arr1, arr2, output)) {
+        return xtensa_array_elemax_impl<Xb>(arr1, arr2, output, length, priority_tag<0>{});
+    }
+    vec_elemax32x32(output, const_cast<int32_t*>(arr1), const_cast<int32_t*>(arr2), static_cast<int>(length));
+}
+
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_elemax_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                         Storage_t<Xb>* output, size_t length, priority_tag<2>)
+{
+    xtensa_array_elemax_impl<Xb>(arr1, arr2, output, length, priority_tag<1>{});
+}
+
+// ========== ELEMENT-WISE MIN ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_elemin_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                         Storage_t<Xb>* output, size_t length, priority_tag<0>)
+{
+    ReferenceBackend::template array_elemin<Xb>(arr1, arr2, output, length);
+}
+
+// -------- Priority 1: 16-bit Specialization --------
+
+template<int Xb, EnableIf<is_16bit<Xb>::value> = 0>
+inline void
+xtensa_array_elemin_impl(const int16_t* arr1, const int16_t* arr2,
+                         int16_t* output, size_t length, priority_tag<1>)
+{
+    if (!all_aligned_8(arr1, arr2, output)) {
+        return xtensa_array_elemin_impl<Xb>(arr1, arr2, output, length, priority_tag<0>{});
+    }
+    vec_elemin16x16(output, const_cast<int16_t*>(arr1), const_cast<int16_t*>(arr2), static_cast<int>(length));
+}
+
+template<int Xb, EnableIf<!is_16bit<Xb>::value> = 0>
+inline void
+xtensa_array_elemin_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                         Storage_t<Xb>* output, size_t length, priority_tag<1>)
+{
+    xtensa_array_elemin_impl<Xb>(arr1, arr2, output, length, priority_tag<0>{});
+}
+
+// -------- Priority 2: 32-bit Specialization --------
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_elemin_impl(const int32_t* arr1, const int32_t* arr2,
+                         int32_t* output, size_t length, priority_tag<2>)
+{
+    if (!all_aligned_8(arr1, arr2, output)) {
+        return xtensa_array_elemin_impl<Xb>(arr1, arr2, output, length, priority_tag<0>{});
+    }
+    vec_elemin32x32(output, const_cast<int32_t*>(arr1), const_cast<int32_t*>(arr2), static_cast<int>(length));
+}
+
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_elemin_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2,
+                         Storage_t<Xb>* output, size_t length, priority_tag<2>)
+{
+    xtensa_array_elemin_impl<Xb>(arr1, arr2, output, length, priority_tag<1>{});
+}
+
+// ========== ELEMENT-WISE ABS ==========
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline void
+xtensa_array_abs_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length,
+                      priority_tag<0>)
+{
+    ReferenceBackend::template array_abs<Xb>(input, output, length);
+}
+
+// -------- Priority 1: 16-bit Specialization --------
+
+template<int Xb, EnableIf<is_16bit<Xb>::value> = 0>
+inline void
+xtensa_array_abs_impl(const int16_t* input, int16_t* output, size_t length, priority_tag<1>)
+{
+    if (!all_aligned_8(input, output)) {
+        return xtensa_array_abs_impl<Xb>(input, output, length, priority_tag<0>{});
+    }
+    vec_eleabs16x16(input, output, static_cast<int>(length));
+}
+
+template<int Xb, EnableIf<!is_16bit<Xb>::value> = 0>
+inline void
+xtensa_array_abs_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length,
+                      priority_tag<1>)
+{
+    xtensa_array_abs_impl<Xb>(input, output, length, priority_tag<0>{});
+}
+
+// -------- Priority 2: 32-bit Specialization --------
+
+template<int Xb, EnableIf<IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_abs_impl(const int32_t* input, int32_t* output, size_t length, priority_tag<2>)
+{
+    if (!all_aligned_8(input, output)) {
+        return xtensa_array_abs_impl<Xb>(input, output, length, priority_tag<0>{});
+    }
+    vec_eleabs32x32(input, output, static_cast<int>(length));
+}
+
+template<int Xb, EnableIf<!IsBucket<Xb, 32>::value> = 0>
+inline void
+xtensa_array_abs_impl(const Storage_t<Xb>* input, Storage_t<Xb>* output, size_t length,
+                      priority_tag<2>)
+{
+    xtensa_array_abs_impl<Xb>(input, output, length, priority_tag<1>{});
+}
+
 } // namespace detail
 } // namespace fp
@@ -12,18 +12,21 @@ namespace detail {
 // ============================================================================
 //
 // Array operations use priority_tag dispatch:
-//   - Priority 2: 32-bit and 8-bit arrays (NatureDSP optimized when available)
+//   - Priority 2: 8-bit arrays (no NatureDSP kernels; forwarded)
 //   - Priority 1: 16-bit arrays (NatureDSP optimized when available)
 //   - Priority 0: Generic fallback to ReferenceBackend
 //
 // NatureDSP functions used:
-//   - vec_dot16x16, vec_dot32x32: Dot product (returns int64_t accumulator)
-//   - vec_dot16x16_fast, vec_dot32x32_fast: Optimized dot product (requires 8-byte alignment, N%4==0)
-//   - vec_sum16x16, vec_sum32x32: Array sum (returns int64_t accumulator)
+//   - vec_dot16x16: Dot product (exact int64_t accumulator)
+//   - vec_dot32x16, vec_dot32x16_fast: 32-bit data with 16-bit coefficients,
+//     returns floor(sum / 2^15) (fractional multiply, then >> 16)
 //   - vec_add16x16, vec_add32x32: Element-wise addition
-//   - vec_power16x16, vec_power32x32: Sum of squares (for RMS)
-//   - Note: No 8-bit variants available (vec_dot8x8, vec_sum8x8, etc.)
-//   - Note: vec_dot16x16_fast returns int32_t (not int64_t)
+//   - vec_power16x16 (rsh = 0): Sum of squares (exact int64_t accumulator)
+//   - Note: No 8-bit variants available (vec_dot8x8, vec_power8x8, etc.)
+//   - Note: vec_dot16x16_fast (32-bit saturating accumulator), vec_dot32x32
+//     (wraps), vec_power32x32 (floors) and vec_sum* (return the element
+//     type) are not used, so dot_product, array_sum and array_power match
+//     the reference engine bit for bit
 //
 // Note: All implementations must be defined in reverse priority order.
 
@@ -31,11 +34,11 @@ namespace detail {
 
 // -------- Priority 0: Generic Fallback → ReferenceBackend --------
 
-template<int Xb>
+template<int Xb, typename L>
 inline Storage_t<Xb>
-xtensa_dot_product_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size_t length, int frac_bits, priority_tag<0>)
+xtensa_dot_product_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size_t length, int frac_bits, L layout, priority_tag<0>)
 {
-    return ReferenceBackend::template dot_product<Xb>(arr1, arr2, length, frac_bits);
+    return ReferenceBackend::template dot_product<Xb>(arr1, arr2, length, frac_bits, layout);
 }
 
 // -------- Priority 1: 16-bit Specialization --------
@@ -44,89 +47,111 @@ template<int Xb>
 using is_16bit = std::integral_constant<bool, IsBucket<Xb, 16>::value>;
 
 // Enabled when 16-bit
-template<int Xb, EnableIf<is_16bit<Xb>::value> = 0>
+// vec_dot16x16 returns the exact 64-bit sum of the Q(2F) products, rounded
+// once by F like the reference engine. vec_dot16x16_fast is not used: its
+// 32-bit saturating accumulator clips sums the reference keeps
+template<int Xb, typename L, EnableIf<is_16bit<Xb>::value> = 0>
 inline int16_t
-xtensa_dot_product_impl(const int16_t* arr1, const int16_t* arr2, size_t length, int frac_bits, priority_tag<1>)
-{
-    // Use NatureDSP vec_dot16x16 which returns 64-bit accumulator
-    // vec_dot16x16: int64_t vec_dot16x16(const int16_t *x, const int16_t *y, int N)
-    // vec_dot16x16_fast: int32_t vec_dot16x16_fast(const int16_t *x, const int16_t *y, int N)
-    //   - Requires 8-byte alignment and N%4==0
-    //   - Returns int32_t accumulator (may overflow for large vectors)
-    // For QI.F format: Q(I,F) * Q(I,F) = Q(2I, 2F) in accumulator
-    // We need to shift right by F to get back to Q(I,F)
-    int64_t result64;
-    if (can_use_fast_variant(arr1, arr2, length)) {
-        // Use fast variant (returns int32_t, cast to int64_t)
-        result64 = static_cast<int64_t>(vec_dot16x16_fast(arr1, arr2, static_cast<int>(length)));
-    } else {
-        // Use normal variant (returns int64_t)
-        result64 = vec_dot16x16(arr1, arr2, static_cast<int>(length));
-    }
-    // Shift by frac_bits to convert from Q(2*F) back to Q(F)
+xtensa_dot_product_impl(const int16_t* arr1, const int16_t* arr2, size_t length, int frac_bits, L, priority_tag<1>)
+{
+    int64_t result64 = vec_dot16x16(arr1, arr2, static_cast<int>(length));
     return sat_cast<int16_t>(round_shift(result64, frac_bits));
 }
 
 // Forward to Priority 0 when NOT 16-bit
-template<int Xb, EnableIf<!is_16bit<Xb>::value> = 0>
+template<int Xb, typename L, EnableIf<!is_16bit<Xb>::value> = 0>
 inline Storage_t<Xb>
-xtensa_dot_product_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size_t length, int frac_bits, priority_tag<1>)
+xtensa_dot_product_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size_t length, int frac_bits, L layout, priority_tag<1>)
 {
-    return xtensa_dot_product_impl<Xb>(arr1, arr2, length, frac_bits, priority_tag<0>{});
+    return xtensa_dot_product_impl<Xb>(arr1, arr2, length, frac_bits, layout, priority_tag<0>{});
 }
 
-// -------- Priority 2: 32-bit and 8-bit Specializations --------
+// -------- Priority 2: 8-bit Specialization --------
+// 32-bit data stays on the reference engine: vec_dot32x32 keeps the 62-bit
+// products in a single 64-bit accumulator, which wraps after a few terms
 
 template<int Xb>
 using is_8bit = std::integral_constant<bool, IsBucket<Xb, 8>::value>;
 
-template<int Xb>
-using is_32bit = std::integral_constant<bool, IsBucket<Xb, 32>::value>;
-
-// Enabled when 32-bit
-template<int Xb, EnableIf<is_32bit<Xb>::value> = 0>
-inline int32_t
-xtensa_dot_product_impl(const int32_t* arr1, const int32_t* arr2, size_t length, int frac_bits, priority_tag<2>)
-{
-    // Use NatureDSP vec_dot32x32 which returns 64-bit accumulator
-    // vec_dot32x32: int64_t vec_dot32x32(const int32_t *x, const int32_t *y, int N)
-    // vec_dot32x32_fast: int64_t vec_dot32x32_fast(const int32_t *x, const int32_t *y, int N)
-    //   - Requires 8-byte alignment and N%4==0
-    // For QI.F format: Q(I,F) * Q(I,F) = Q(2I, 2F) in 64-bit accumulator
-    // We need to shift right by F to get back to Q(I,F)
-    int64_t result64;
-    if (can_use_fast_variant(arr1, arr2, length)) {
-        // Use fast variant
-        result64 = vec_dot32x32_fast(arr1, arr2, static_cast<int>(length));
-    } else {
-        // Use normal variant
-        result64 = vec_dot32x32(arr1, arr2, static_cast<int>(length));
-    }
-    // Shift by frac_bits to convert from Q(2*F) back to Q(F)
-    return sat_cast<int32_t>(round_shift(result64, frac_bits));
-}
-
 // Enabled when 8-bit
-template<int Xb, EnableIf<is_8bit<Xb>::value> = 0>
+template<int Xb, typename L, EnableIf<is_8bit<Xb>::value> = 0>
 inline int8_t
-xtensa_dot_product_impl(const int8_t* arr1, const int8_t* arr2, size_t length, int frac_bits, priority_tag<2>)
+xtensa_dot_product_impl(const int8_t* arr1, const int8_t* arr2, size_t length, int frac_bits, L layout, priority_tag<2>)
 {
     // NatureDSP doesn't have vec_dot8x8, use reference implementation
-    return xtensa_dot_product_impl<Xb>(arr1, arr2, length, frac_bits, priority_tag<1>{});
+    return xtensa_dot_product_impl<Xb>(arr1, arr2, length, frac_bits, layout, priority_tag<1>{});
 }
 
-// Forward to Priority 1 when NOT 32-bit and NOT 8-bit
-template<int Xb, EnableIf<!is_32bit<Xb>::value && !is_8bit<Xb>::value> = 0>
+// Forward to Priority 1 when NOT 8-bit
+template<int Xb, typename L, EnableIf<!is_8bit<Xb>::value> = 0>
 inline Storage_t<Xb>
-xtensa_dot_product_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size_t length, int frac_bits, priority_tag<2>)
+xtensa_dot_product_impl(const Storage_t<Xb>* arr1, const Storage_t<Xb>* arr2, size_t length, int frac_bits, L layout, priority_tag<2>)
 {
-    return xtensa_dot_product_impl<Xb>(arr1, arr2, length, frac_bits, priority_tag<1>{});
+    return xtensa_dot_product_impl<Xb>(arr1, arr2, length, frac_bits, layout, priority_tag<1>{});
 }
 
-// ========== ARRAY SUM ==========
+// ========== MIXED-PRECISION DOT PRODUCT ==========
 
 // -------- Priority 0: Generic Fallback → ReferenceBackend --------
 
+template<int Xb, int Yb, int Ob>
+inline Storage_t<Ob>
+xtensa_dot_product_mixed_impl(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2, size_t length, int shift,
+                              priority_tag<0>)
+{
+    return ReferenceBackend::template dot_product_mixed<Xb, Yb, Ob>(arr1, arr2, length, shift);
+}
+
+// -------- Priority 1: 32x16 (either operand order) --------
+
+template<int Xb, int Yb>
+using is_32x16 = std::integral_constant<bool, IsBucket<Xb, 32>::value && IsBucket<Yb, 16>::value>;
+
+// vec_dot32x16 drops the low 15 bits of the sum (truncating), so it is used
+// when the result is rounded by at least that much anyway: the value is
+// then within 1 LSB of the reference (exact unless the dropped bits decide
+// a rounding tie). Smaller shifts keep the exact reference sum.
+template<int Xb, int Yb, int Ob, EnableIf<is_32x16<Xb, Yb>::value> = 0>
+inline Storage_t<Ob>
+xtensa_dot_product_mixed_impl(const int32_t* arr1, const int16_t* arr2, size_t length, int shift,
+                              priority_tag<1>)
+{
+    if (length == 0 || shift < 15) {
+        return xtensa_dot_product_mixed_impl<Xb, Yb, Ob>(arr1, arr2, length, shift, priority_tag<0>{});
+    }
+    int64_t result64;
+    bool fast = length % 4 == 0 && ((reinterpret_cast<uintptr_t>(arr1) & 7) == 0) &&
+                ((reinterpret_cast<uintptr_t>(arr2) & 7) == 0);
+    if (fast) {
+        result64 = vec_dot32x16_fast(arr1, arr2, static_cast<int>(length));
+    } else {
+        result64 = vec_dot32x16(arr1, arr2, static_cast<int>(length));
+    }
+    return sat_cast<Storage_t<Ob>>(round_shift(result64, shift - 15));
+}
+
+template<int Xb, int Yb, int Ob, EnableIf<is_32x16<Yb, Xb>::value> = 0>
+inline Storage_t<Ob>
+xtensa_dot_product_mixed_impl(const int16_t* arr1, const int32_t* arr2, size_t length, int shift,
+                              priority_tag<1>)
+{
+    return xtensa_dot_product_mixed_impl<Yb, Xb, Ob>(arr2, arr1, length, shift, priority_tag<1>{});
+}
+
+// Forward to Priority 0 for every other width pair
+template<int Xb, int Yb, int Ob, EnableIf<!is_32x16<Xb, Yb>::value && !is_32x16<Yb, Xb>::value> = 0>
+inline Storage_t<Ob>
+xtensa_dot_product_mixed_impl(const Storage_t<Xb>* arr1, const Storage_t<Yb>* arr2, size_t length, int shift,
+                              priority_tag<1>)
+{
+    return xtensa_dot_product_mixed_impl<Xb, Yb, Ob>(arr1, arr2, length, shift, priority_tag<0>{});
+}
+
+// ========== ARRAY SUM ==========
+// vec_sum16x16 / vec_sum32x32 return the element type (int16_t / int32_t)
+// with undocumented overflow handling, so sums stay on the reference engine,
+// which accumulates exactly and saturates once
+
 template<int Xb>
 inline Storage_t<Xb>
 xtensa_array_sum_impl(const Storage_t<Xb>* arr, size_t length, priority_tag<0>)
@@ -134,61 +159,71 @@ xtensa_array_sum_impl(const Storage_t<Xb>* arr, size_t length, priority_tag<0>)
     return ReferenceBackend::template array_sum<Xb>(arr, length);
 }
 
+// ========== POWER (SUM OF SQUARES) ==========
+// vec_power16x16 with rsh = 0 returns the exact 64-bit sum of squares, rounded
+// once by frac_bits like the reference engine (a nonzero rsh would floor).
+// vec_power32x32 only takes rsh >= 31 and floors, so 32-bit data stays on the
+// reference engine
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb>
+inline Storage_t<Xb>
+xtensa_array_power_impl(const Storage_t<Xb>* arr, size_t length, int frac_bits, priority_tag<0>)
+{
+    return ReferenceBackend::template array_power<Xb>(arr, length, frac_bits);
+}
+
 // -------- Priority 1: 16-bit Specialization --------
 
-// Enabled when 16-bit
 template<int Xb, EnableIf<is_16bit<Xb>::value> = 0>
 inline int16_t
-xtensa_array_sum_impl(const int16_t* arr, size_t length, priority_tag<1>)
+xtensa_array_power_impl(const int16_t* arr, size_t length, int frac_bits, priority_tag<1>)
 {
     if (length == 0) return 0;
-
-    // Use NatureDSP vec_sum16x16
-    // vec_sum16x16: int64_t vec_sum16x16(const int16_t *x, int N)
-    // Returns sum of all elements in 64-bit accumulator
-    int64_t sum64 = vec_sum16x16(arr, static_cast<int>(length));
-    return sat_cast<int16_t>(sum64);
+    int64_t power64 = vec_power16x16(arr, 0, static_cast<int>(length));
+    return sat_cast<int16_t>(round_shift(power64, frac_bits));
 }
 
-// Forward to Priority 0 when NOT 16-bit
 template<int Xb, EnableIf<!is_16bit<Xb>::value> = 0>
 inline Storage_t<Xb>
-xtensa_array_sum_impl(const Storage_t<Xb>* arr, size_t length, priority_tag<1>)
+xtensa_array_power_impl(const Storage_t<Xb>* arr, size_t length, int frac_bits, priority_tag<1>)
 {
-    return xtensa_array_sum_impl<Xb>(arr, length, priority_tag<0>{});
+    return xtensa_array_power_impl<Xb>(arr, length, frac_bits, priority_tag<0>{});
 }
 
-// -------- Priority 2: 32-bit and 8-bit Specializations --------
+// ========== EUCLIDEAN NORM ==========
+//
+// vec_power16x16 with rsh = 0 returns the exact 64-bit sum of squares; the
+// root is taken by the same rounded integer sqrt as the reference kernel.
+// vec_power32x32 cannot keep the low bits (rsh >= 31), so 32-bit data and
+// 8-bit data (no NatureDSP kernel) stay on the reference path
 
-// Enabled when 32-bit
-template<int Xb, EnableIf<is_32bit<Xb>::value> = 0>
-inline int32_t
-xtensa_array_sum_impl(const int32_t* arr, size_t length, priority_tag<2>)
-{
-    if (length == 0) return 0;
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
 
-    // Use NatureDSP vec_sum32x32
-    // vec_sum32x32: int64_t vec_sum32x32(const int32_t *x, int N)
-    // Returns sum of all elements in 64-bit accumulator
-    int64_t sum64 = vec_sum32x32(arr, static_cast<int>(length));
-    return sat_cast<int32_t>(sum64);
+template<int Xb, int Ob>
+inline Storage_t<Ob>
+xtensa_array_nrm2_impl(const Storage_t<Xb>* arr, size_t length, int frac_bits, int out_frac, priority_tag<0>)
+{
+    return ReferenceBackend::template array_nrm2<Xb, Ob>(arr, length, frac_bits, out_frac);
 }
 
-// Enabled when 8-bit
-template<int Xb, EnableIf<is_8bit<Xb>::value> = 0>
-inline int8_t
-xtensa_array_sum_impl(const int8_t* arr, size_t length, priority_tag<2>)
+// -------- Priority 1: 16-bit Specialization --------
+
+template<int Xb, int Ob, EnableIf<is_16bit<Xb>::value> = 0>
+inline Storage_t<Ob>
+xtensa_array_nrm2_impl(const int16_t* arr, size_t length, int frac_bits, int out_frac, priority_tag<1>)
 {
-    // NatureDSP doesn't have vec_sum8x8 - use reference implementation
-    return xtensa_array_sum_impl<Xb>(arr, length, priority_tag<1>{});
+    if (length == 0) return 0;
+    int64_t power64 = vec_power16x16(arr, 0, static_cast<int>(length));
+    return isqrt_fixed<Storage_t<Ob>>(power64, 2 * frac_bits, out_frac);
 }
 
-// Forward to Priority 1 when NOT 32-bit and NOT 8-bit
-template<int Xb, EnableIf<!is_32bit<Xb>::value && !is_8bit<Xb>::value> = 0>
-inline Storage_t<Xb>
-xtensa_array_sum_impl(const Storage_t<Xb>* arr, size_t length, priority_tag<2>)
+template<int Xb, int Ob, EnableIf<!is_16bit<Xb>::value> = 0>
+inline Storage_t<Ob>
+xtensa_array_nrm2_impl(const Storage_t<Xb>* arr, size_t length, int frac_bits, int out_frac, priority_tag<1>)
 {
-    return xtensa_array_sum_impl<Xb>(arr, length, priority_tag<1>{});
+    return xtensa_array_nrm2_impl<Xb, Ob>(arr, length, frac_bits, out_frac, priority_tag<0>{});
 }
 
 } // namespace detail
@@ -0,0 +1,119 @@
+#pragma once
+#include "../../helpers.hpp"
+#include "../reference/backend.hpp"
+#include "vector_helpers.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace fp {
+namespace detail {
+
+// ============================================================================
+// Xtensa Compile-Time Polynomial Evaluation
+// ============================================================================
+//
+// NatureDSP Functions Used:
+//   - vec_poly4_32x32, vec_poly8_32x32: Horner's rule on Q31 data with five /
+//     nine Q31 coefficients (c[0] constant term), a rounding Q31 multiply
+//     per stage, and a saturating left shift lsh (0..31) of the result
+//
+// 32-bit data and output of degree up to 8 map onto them; lower degrees are
+// padded with zero leading coefficients. The x format and the coefficient
+// range are folded into the coefficients at compile time:
+//   - NatureDSP reads x as Q31, i.e. x' = x * 2^(F - 31), so c_k becomes
+//     c_k * 2^((31 - F) * k)
+//   - every Horner partial sum must stay below 1 in Q31: coefficients are
+//     scaled by 2^-s, s from the stage bounds, and lsh = OF - 31 + s
+//     restores the output format
+// Every coefficient and every stage product rounds at Q(31 - s), at most
+// half a unit each, and |x'| <= 1 keeps those errors from growing; the left
+// shift then multiplies them by 2^lsh. Against the exact polynomial the
+// output is off by at most max_error_lsb = (2 * terms - 1) / 2 * 2^lsh LSB,
+// and only plans with lsh <= 2 are used (at most 34 LSB at degree 8, 3.5
+// for a cubic at lsh = 0). NatureDSP requires x and z not to overlap, so
+// overlapping calls run the reference kernel, as does everything else
+// (8/16-bit data, degree above 8, larger shifts).
+
+template<int F, int OF, int CF, int64_t... C>
+struct NdspPolyPlan {
+    static constexpr size_t terms = sizeof...(C);
+    static constexpr size_t slots = terms <= 5 ? 5 : 9;
+    static constexpr std::array<int64_t, terms> coef{{C...}};
+
+    // Largest Horner partial-sum exponent of the rescaled polynomial: with
+    // |x'| <= 1 the stage bounds are the running sums of |c_k|, top down
+    static constexpr int bound_exponent = [] {
+        double bound = 0.0;
+        int e = -1000;
+        for (size_t k = terms; k-- > 0;) {
+            bound += static_cast<double>(coef[k] < 0 ? -coef[k] : coef[k]) *
+                     poly_pow2(-CF + (31 - F) * static_cast<int>(k));
+            int ek = poly_exponent(bound * (1.0 + 1e-9));
+            e = ek > e ? ek : e;
+        }
+        return e;
+    }();
+
+    static constexpr int s = bound_exponent > 31 - OF ? bound_exponent : 31 - OF;
+    static constexpr int lsh = OF - 31 + s;
+    static constexpr bool usable = terms <= 9 && lsh >= 0 && lsh <= 2 && s <= 31;
+
+    // Worst-case distance from the exact polynomial, in output LSB
+    static constexpr double max_error_lsb = (static_cast<double>(terms) - 0.5) * poly_pow2(lsh);
+
+    // Q31 coefficients scaled by 2^-s, zero padded to the kernel's count
+    static constexpr std::array<int32_t, slots> q31 = [] {
+        std::array<int32_t, slots> a{};
+        for (size_t k = 0; k < terms && usable; ++k) {
+            int shift = CF - (31 - s) - (31 - F) * static_cast<int>(k);
+            a[k] = static_cast<int32_t>(poly_align(coef[k], shift));
+        }
+        return a;
+    }();
+};
+
+template<int Xb>
+using is_32bit = std::integral_constant<bool, IsBucket<Xb, 32>::value>;
+
+// -------- Priority 0: Generic Fallback → ReferenceBackend --------
+
+template<int Xb, int Ob, int F, int OF, int CF, int64_t... C>
+inline void
+xtensa_array_poly_impl(const Storage_t<Xb>* x, Storage_t<Ob>* output, size_t length, priority_tag<0>)
+{
+    ReferenceBackend::template array_poly<Xb, Ob, F, OF, CF, C...>(x, output, length);
+}
+
+// -------- Priority 1: 32-bit data and output, degree <= 8 --------
+
+template<int Xb, int Ob, int F, int OF, int CF, int64_t... C,
+         EnableIf<is_32bit<Xb>::value && is_32bit<Ob>::value && NdspPolyPlan<F, OF, CF, C...>::usable> = 0>
+inline void
+xtensa_array_poly_impl(const int32_t* x, int32_t* output, size_t length, priority_tag<1>)
+{
+    using Plan = NdspPolyPlan<F, OF, CF, C...>;
+    if (length == 0) return;
+
+    // vec_poly*: x and z must not overlap
+    if (ranges_overlap(x, length, output, length)) {
+        return xtensa_array_poly_impl<Xb, Ob, F, OF, CF, C...>(x, output, length, priority_tag<0>{});
+    }
+    if constexpr (Plan::slots == 5) {
+        vec_poly4_32x32(output, x, Plan::q31.data(), Plan::lsh, static_cast<int>(length));
+    } else {
+        vec_poly8_32x32(output, x, Plan::q31.data(), Plan::lsh, static_cast<int>(length));
+    }
+}
+
+template<int Xb, int Ob, int F, int OF, int CF, int64_t... C,
+         EnableIf<!(is_32bit<Xb>::value && is_32bit<Ob>::value && NdspPolyPlan<F, OF, CF, C...>::usable)> = 0>
+inline void
+xtensa_array_poly_impl(const Storage_t<Xb>* x, Storage_t<Ob>* output, size_t length, priority_tag<1>)
+{
+    xtensa_array_poly_impl<Xb, Ob, F, OF, CF, C...>(x, output, length, priority_tag<0>{});
+}
+
+} // namespace detail
+} // namespace fp
@@ -281,5 +281,18 @@ xtensa_array_stddev_impl(const Storage_t<Xb>* arr, size_t length, int frac_bits,
     return xtensa_array_stddev_impl<Xb>(arr, length, frac_bits, priority_tag<1>{});
 }
 
+// ========== FUSED STATISTICS ==========
+// NatureDSP computes each statistic in its own call (its own pass over x);
+// the fused single-pass kernel has no counterpart, so all formats use the
+// reference reduction lanes
+
+template<int Xb, unsigned Mask>
+inline ArrayStatsRaw<Storage_t<Xb>>
+xtensa_array_stats_impl(const Storage_t<Xb>* arr, size_t length, int frac_bits,
+                        priority_tag<0>)
+{
+    return detail::reference_array_stats<Xb, Mask>(arr, length, frac_bits);
+}
+
 } // namespace detail
 } // namespace fp
@@ -1,5 +1,4 @@
 #include "nlms_node.h"
-#include <cstring>
 #include <cstdio>
 #include <string>
 #include "../observer.hpp"
@@ -61,15 +60,19 @@ namespace mimi {
         using OMu = obs::Observed<float, obs_tags::MuCalcTag>;
         using OIr = obs::Observed<float, obs_tags::IrUpdateTag>;
 
-        // roll the input buffer
-        memmove(inputBuffer.data() + 1, inputBuffer.data(), (config.estimateLength - 1) * sizeof(float));
-        inputBuffer[0] = micInput;
-
-        // roll the speaker buffer
-        memmove(speakerBuffer.data() + 1, speakerBuffer.data(), (config.estimateLength - 1) * sizeof(float));
-        speakerBuffer[0] = spkFeedback;
-
-        float feedbackEstimate = dot(speakerBuffer.data(), irEstimate.data(), config.estimateLength);
+        // advance the delay lines: the newest sample goes in front of the
+        // window, written twice so the window stays contiguous
+        if (delayLinePtr == 0) {
+            delayLinePtr = config.estimateLength;
+        }
+        delayLinePtr--;
+        inputBuffer[delayLinePtr] = micInput;
+        inputBuffer[delayLinePtr + config.estimateLength] = micInput;
+        speakerBuffer[delayLinePtr] = spkFeedback;
+        speakerBuffer[delayLinePtr + config.estimateLength] = spkFeedback;
+        float* speakerWindow = speakerBuffer.data() + delayLinePtr;
+
+        float feedbackEstimate = dot(speakerWindow, irEstimate.data(), config.estimateLength);
         float error = (float)(OErr{micInput} - OErr{feedbackEstimate});
 
         // update energy buffers used for normalization
@@ -103,7 +106,7 @@ namespace mimi {
 
         // update the IR according to the gradient estimate
         for (uint32_t idx = 0; idx < config.estimateLength; idx++) {
-            float gradientEstimate = (float)(OIr{error} * OIr{speakerBuffer[idx]});
+            float gradientEstimate = (float)(OIr{error} * OIr{speakerWindow[idx]});
             float filterStep = (float)(OIr{gradientEstimate} * OIr{muFinal});
             irEstimate[idx] = (float)(OIr{irEstimate[idx]} + OIr{filterStep});
         }
@@ -156,8 +159,9 @@ namespace mimi {
 
         irEstimate.resize(config.estimateLength);
 
-        speakerBuffer.resize(config.estimateLength);
-        inputBuffer.resize(config.estimateLength);
+        speakerBuffer.resize(2 * config.estimateLength);
+        inputBuffer.resize(2 * config.estimateLength);
+        delayLinePtr = 0;
 
         inputEnergyBuffer.resize(config.estimateLength);
 
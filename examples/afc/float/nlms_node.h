@@ -1,6 +1,7 @@
 #ifndef MIMI_AFC_NLMS_NODE_H
 #define MIMI_AFC_NLMS_NODE_H
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -27,8 +28,13 @@ namespace mimi {
 
         std::vector<float> irEstimate;
 
+        // Delay lines of 2 * estimateLength: each sample is written at
+        // delayLinePtr and delayLinePtr + estimateLength, so the last
+        // estimateLength samples are always contiguous at delayLinePtr,
+        // newest first (no memmove per sample)
         std::vector<float> speakerBuffer;
         std::vector<float> inputBuffer;
+        uint32_t delayLinePtr;
 
         std::vector<float> speakerDelayBuffer;
         uint32_t speakerDelaySize;
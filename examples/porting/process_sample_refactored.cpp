@@ -188,13 +188,17 @@ public:
     using EnergyFormat = FixedPoint<5, 26, Backend>;    // Q5.26 (original: Q26) - NOT Q10.52!
     using MuFormat = FixedPoint<0, 31, Backend>;        // Q0.31 for mu (always < 1.0)
 
-    // Buffers with explicit Q-format types
-    std::array<SpeakerFormat, FILTER_LENGTH> speaker_buffer;
+    // Buffers with explicit Q-format types; the speaker delay line keeps the
+    // last FILTER_LENGTH samples contiguous, newest first (O(1) push)
+    RingBuffer<0, 31, FILTER_LENGTH, Backend> speaker_buffer;
     std::array<IrFormat, FILTER_LENGTH> ir_estimate;
-    std::array<EnergyFormat, FILTER_LENGTH> input_energy_buffer;
-    std::array<EnergyFormat, FILTER_LENGTH> error_energy_buffer;
 
-    uint32_t energy_ptr = 0;
+    // Energy windows: O(1) running mean instead of a pass over the buffer
+    // per sample (reset() zero-fills, so the mean is over FILTER_LENGTH
+    // like the original circular buffer)
+    using EnergyWindow = SlidingWindowStats<5, 26, FILTER_LENGTH, false, Backend>;
+    EnergyWindow input_energy;
+    EnergyWindow error_energy;
     float input_energy_smooth = 1.0f;
     float error_energy_smooth = 1.0f;
 
@@ -208,20 +212,23 @@ public:
 
     // Note: We use built-in library functions - no need to implement dot() or mean()!
 
+    AfcNlmsNode() {
+        input_energy.reset();
+        error_energy.reset();
+    }
+
     /**
      * Process a single sample with type-safe fixed-point arithmetic
      *
      * No magic numbers, no manual shifts, automatic saturation!
      */
     ErrorFormat processSample(SpeakerFormat micInput, SpeakerFormat spkFeedback) {
-        // Roll the speaker buffer
-        std::copy(speaker_buffer.begin(), speaker_buffer.end() - 1,
-                 speaker_buffer.begin() + 1);
-        speaker_buffer[0] = spkFeedback;
+        // Push into the delay line: no roll, speaker_buffer[k] is x[n - k]
+        speaker_buffer.push(spkFeedback);
 
         // Use built-in dot product with explicit output format
         // Q0.31 * Q5.26 with output Q5.26 (matches original behavior)
-        auto feedbackEstimate = fp::dot<5, 26>(speaker_buffer.data(), ir_estimate.data(),
+        auto feedbackEstimate = fp::dot<5, 26>(speaker_buffer.view().data(), ir_estimate.data(),
                                               FILTER_LENGTH);
 
         // Subtraction in common Q5.26 format
@@ -232,21 +239,16 @@ public:
         // Note: mul_as<>() is scalar (like mimi_mul_32x32, uses 64-bit intermediate)
         //       BUT mul_as<>() uses ROUNDING while mimi_mul_32x32 just truncates
         //       For arrays, use fp::vec_elemult<5,26>() to get 32-bit SIMD (NatureDSP)
-        input_energy_buffer[energy_ptr] = mul_as<5, 26>(micInput, micInput);
-        error_energy_buffer[energy_ptr] = mul_as<5, 26>(error, error);
-
-        energy_ptr++;
-        if (energy_ptr == FILTER_LENGTH) {
-            energy_ptr = 0;
-        }
+        input_energy.push(mul_as<5, 26>(micInput, micInput));
+        error_energy.push(mul_as<5, 26>(error, error));
 
-        // Learning rate calculation using built-in fp::mean()
-        auto currInputEnergy = fp::mean(input_energy_buffer.data(), FILTER_LENGTH);
+        // Learning rate calculation from the running window means
+        auto currInputEnergy = input_energy.mean();
         float currInputEnergyFloat = currInputEnergy.to_float();
         input_energy_smooth = input_energy_smooth +
             input_energy_lambda * (currInputEnergyFloat - input_energy_smooth);
 
-        auto currErrorEnergy = fp::mean(error_energy_buffer.data(), FILTER_LENGTH);
+        auto currErrorEnergy = error_energy.mean();
         float currErrorEnergyFloat = currErrorEnergy.to_float();
         error_energy_smooth = error_energy_smooth +
             error_energy_lambda * (currErrorEnergyFloat - error_energy_smooth);
@@ -317,7 +319,7 @@ void demonstrate_refactoring() {
     std::memset(manual_nlms.ir_estimate, 0, sizeof(manual_nlms.ir_estimate));
     manual_nlms.ir_estimate[0] = (int32_t)(0.5f * (1 << 26)); // Q26
 
-    fplib_nlms.speaker_buffer.fill(with_fplib::AfcNlmsNode<>::SpeakerFormat::from_float(0.0f));
+    fplib_nlms.speaker_buffer.reset();
     fplib_nlms.ir_estimate.fill(with_fplib::AfcNlmsNode<>::IrFormat::from_float(0.0f));
     fplib_nlms.ir_estimate[0] = with_fplib::AfcNlmsNode<>::IrFormat::from_float(0.5f);
 
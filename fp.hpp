@@ -2,7 +2,15 @@
 #include <type_traits>
 #include <cstdint>
 #include <cmath>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <array>
 #include "helpers.hpp"     // must provide: StorageForBits<>, sat_cast<>
+#include "parallel.hpp"    // execution policies, ThreadPool
 #include "backends/reference/backend.hpp"  // ReferenceBackend implementation
 #ifdef __XTENSA__
 #include "backends/xtensa/backend.hpp"     // XtensaBackend implementation (only for Xtensa builds)
@@ -220,48 +228,59 @@ struct FixedPoint {
         return !(*this == rhs);
     }
 
-    // Logarithm operations (input converted to Q16.15, output as Q6.25)
+    // Transcendental operations take an optional accuracy tier:
+    //   x.sin()              // fp::precise (default)
+    //   x.sin<fp::fast>()    // lowest-degree polynomial, ~1e-4 error
+    // See backends/reference/poly_approx.hpp for the per-tier error bounds
+
+    // Logarithm operations (output as Q6.25)
+    template<typename Acc = precise>
     auto log2() const {
         using Out = FixedPoint<6, 25, Backend>;  // Q6.25 output
-        int32_t result = Backend::template log2<total_bits>(raw_, F);
+        int32_t result = Backend::template log2<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
+    template<typename Acc = precise>
     auto logn() const {
         using Out = FixedPoint<6, 25, Backend>;  // Q6.25 output
-        int32_t result = Backend::template logn<total_bits>(raw_, F);
+        int32_t result = Backend::template logn<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
+    template<typename Acc = precise>
     auto log10() const {
         using Out = FixedPoint<6, 25, Backend>;  // Q6.25 output
-        int32_t result = Backend::template log10<total_bits>(raw_, F);
+        int32_t result = Backend::template log10<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
     // Antilogarithm operations (2^x, e^x, 10^x)
     // Input is interpreted as Q6.25, output is Q16.15
+    template<typename Acc = precise>
     auto antilog2() const {
         using Out = FixedPoint<16, 15, Backend>;  // Q16.15 output
-        int32_t result = Backend::template antilog2<total_bits>(raw_, F);
+        int32_t result = Backend::template antilog2<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
+    template<typename Acc = precise>
     auto antilogn() const {
         using Out = FixedPoint<16, 15, Backend>;  // Q16.15 output
-        int32_t result = Backend::template antilogn<total_bits>(raw_, F);
+        int32_t result = Backend::template antilogn<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
+    template<typename Acc = precise>
     auto antilog10() const {
         using Out = FixedPoint<16, 15, Backend>;  // Q16.15 output
-        int32_t result = Backend::template antilog10<total_bits>(raw_, F);
+        int32_t result = Backend::template antilog10<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
     // Power operation: this^exponent
     // Returns a FixedPoint with the same format as this (the base)
-    template<typename Other>
+    template<typename Acc = precise, typename Other>
     auto pow(const Other& exponent) const {
         using Out = FixedPoint<I, F, Backend>;
         constexpr int Xb = total_bits;
@@ -272,22 +291,24 @@ struct FixedPoint {
 
         Ax ax = static_cast<Ax>(raw_);
         By by = static_cast<By>(exponent.raw());
-        auto result = Backend::template pow<Xb, Yb>(ax, by, F, Other::frac_bits);
+        auto result = Backend::template pow<Xb, Yb, Acc>(ax, by, F, Other::frac_bits);
         return Out(result);
     }
 
     // Square root operation (returns same Q format as input)
+    template<typename Acc = precise>
     auto sqrt() const {
         using Out = FixedPoint<I, F, Backend>;
-        auto result = Backend::template sqrt<total_bits>(raw_, F);
+        auto result = Backend::template sqrt<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
     // Reciprocal square root operation: 1/sqrt(x)
     // Returns same Q format as input
+    template<typename Acc = precise>
     auto rsqrt() const {
         using Out = FixedPoint<I, F, Backend>;
-        auto result = Backend::template rsqrt<total_bits>(raw_, F);
+        auto result = Backend::template rsqrt<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
@@ -303,41 +324,47 @@ struct FixedPoint {
     }
 
     // Trigonometric operations (input/output in radians, same Q format)
+    template<typename Acc = precise>
     auto sin() const {
         using Out = FixedPoint<I, F, Backend>;
-        auto result = Backend::template sin<total_bits>(raw_, F);
+        auto result = Backend::template sin<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
+    template<typename Acc = precise>
     auto cos() const {
         using Out = FixedPoint<I, F, Backend>;
-        auto result = Backend::template cos<total_bits>(raw_, F);
+        auto result = Backend::template cos<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
+    template<typename Acc = precise>
     auto tan() const {
         using Out = FixedPoint<I, F, Backend>;
-        auto result = Backend::template tan<total_bits>(raw_, F);
+        auto result = Backend::template tan<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
+    template<typename Acc = precise>
     auto atan() const {
         using Out = FixedPoint<I, F, Backend>;
-        auto result = Backend::template atan<total_bits>(raw_, F);
+        auto result = Backend::template atan<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
     // Hyperbolic functions (same Q format)
+    template<typename Acc = precise>
     auto tanh() const {
         using Out = FixedPoint<I, F, Backend>;
-        auto result = Backend::template tanh<total_bits>(raw_, F);
+        auto result = Backend::template tanh<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
     // Activation functions (same Q format)
+    template<typename Acc = precise>
     auto sigmoid() const {
         using Out = FixedPoint<I, F, Backend>;
-        auto result = Backend::template sigmoid<total_bits>(raw_, F);
+        auto result = Backend::template sigmoid<total_bits, Acc>(raw_, F);
         return Out(result);
     }
 
@@ -352,6 +379,187 @@ struct FixedPoint {
 template<int I, int F, typename Backend = ReferenceBackend>
 using q = FixedPoint<I,F,Backend>;
 
+// ============================================================================
+// LogFixed: log-domain fixed-point number
+// ============================================================================
+//
+// Stores a value as its sign plus log2|x| in Q<I,F>. Multiply and divide
+// become add and subtract of the logs, integer powers and roots become
+// scaling, so gain chains and normalized step sizes (mu = alpha / energy)
+// cost an add instead of a wide multiply or a divide. Conversions to and
+// from linear FixedPoint use the backend log2_q / exp2_q kernels.
+//
+// Zero is the most negative log value (log2(0) = -inf); results whose log
+// underflows the Q<I,F> range flush to zero, overflows saturate.
+//
+//   auto e  = fp::LogFixed<6, 25>::from_linear(energy);   // one log2
+//   auto mu = (alpha / e).to_linear<1, 31>();            // subtract + exp2
+
+template<int I, int F, typename Backend = ReferenceBackend>
+class LogFixed {
+public:
+    static constexpr int int_bits = I;
+    static constexpr int frac_bits = F;
+    static constexpr int total_bits = I + F;
+    using storage_t = Storage_t<total_bits>;
+    using log_type  = FixedPoint<I, F, Backend>;
+
+private:
+    static constexpr storage_t zero_log = std::numeric_limits<storage_t>::min();
+
+    storage_t log_;   // log2|x| in Q<I,F>
+    bool neg_;
+
+    constexpr LogFixed(storage_t log2_raw, bool negative)
+        : log_(log2_raw), neg_(negative && log2_raw != zero_log) {}
+
+    // Saturating constructor from a widened log sum
+    static LogFixed from_wide(int64_t log2_raw, bool negative) {
+        if (log2_raw <= zero_log) return zero();
+        return LogFixed(sat_cast<storage_t>(log2_raw), negative);
+    }
+
+public:
+    // Default constructs zero
+    constexpr LogFixed() : log_(zero_log), neg_(false) {}
+
+    static constexpr LogFixed zero() { return LogFixed(); }
+    static constexpr LogFixed one()  { return LogFixed(storage_t(0), false); }
+
+    // Build directly from a log2 magnitude
+    static LogFixed from_log2(const log_type& log2_mag, bool negative = false) {
+        return LogFixed(log2_mag.raw(), negative);
+    }
+
+    // Linear -> log domain (one log2 kernel call)
+    template<typename Acc = precise, int LI, int LF>
+    static LogFixed from_linear(const FixedPoint<LI, LF, Backend>& x) {
+        constexpr int Xb = LI + LF;
+        using Ax = Storage_t<Xb>;
+
+        Ax raw = x.raw();
+        if (raw == 0) return zero();
+
+        bool negative = raw < 0;
+        Ax mag = negative ? sat_cast<Ax>(-static_cast<int64_t>(raw)) : raw;
+        return LogFixed(Backend::template log2_q<Xb, total_bits, Acc>(mag, LF, F), negative);
+    }
+
+    // Log -> linear domain (one exp2 kernel call), saturates to Q<OI,OF>
+    template<int OI, int OF, typename Acc = precise>
+    FixedPoint<OI, OF, Backend> to_linear() const {
+        using Out = FixedPoint<OI, OF, Backend>;
+        using Ro  = typename Out::storage_t;
+        if (is_zero()) return Out();
+
+        Ro mag = Backend::template exp2_q<total_bits, Out::total_bits, Acc>(log_, F, OF);
+        return Out(neg_ ? static_cast<Ro>(-mag) : mag);
+    }
+
+    static LogFixed from_float(float v) {
+        if (v == 0.0f) return zero();
+        long long q = llroundf(std::log2(std::fabs(v)) * static_cast<float>(1u << F));
+        return from_wide(q, v < 0.0f);
+    }
+
+    float to_float() const {
+        if (is_zero()) return 0.0f;
+        float mag = std::exp2(static_cast<float>(log_) / static_cast<float>(1u << F));
+        return neg_ ? -mag : mag;
+    }
+
+    // Accessors
+    log_type log2() const { return log_type(log_); }
+    storage_t raw_log() const { return log_; }
+    bool is_zero() const { return log_ == zero_log; }
+    bool is_negative() const { return neg_; }
+
+    // Multiply / divide: add / subtract logs, xor signs
+    LogFixed operator*(const LogFixed& rhs) const {
+        if (is_zero() || rhs.is_zero()) return zero();
+        return from_wide(static_cast<int64_t>(log_) + rhs.log_, neg_ != rhs.neg_);
+    }
+
+    // Division by zero saturates to the largest magnitude
+    LogFixed operator/(const LogFixed& rhs) const {
+        if (is_zero()) return zero();
+        if (rhs.is_zero()) return from_wide(std::numeric_limits<storage_t>::max(), neg_);
+        return from_wide(static_cast<int64_t>(log_) - rhs.log_, neg_ != rhs.neg_);
+    }
+
+    LogFixed& operator*=(const LogFixed& rhs) { return *this = *this * rhs; }
+    LogFixed& operator/=(const LogFixed& rhs) { return *this = *this / rhs; }
+
+    LogFixed operator-() const { return LogFixed(log_, !neg_); }
+    LogFixed abs() const { return LogFixed(log_, false); }
+
+    // 1/x: negate the log
+    LogFixed reciprocal() const {
+        return one() / *this;
+    }
+
+    // Integer power: scale the log by n
+    LogFixed pow(int n) const {
+        if (n == 0) return one();
+        if (is_zero()) return (n > 0) ? zero() : one() / zero();
+        return from_wide(static_cast<int64_t>(log_) * n, neg_ && (n & 1));
+    }
+
+    // Fixed-point power: scale the log by the exponent
+    // Returns 0 for base <= 0 (same convention as FixedPoint::pow)
+    template<typename Other>
+    LogFixed pow(const Other& exponent) const {
+        if (is_zero() || neg_) return zero();
+        return from_wide(detail::mul_shift_sat(log_, exponent.raw(), Other::frac_bits), false);
+    }
+
+    // sqrt / rsqrt: halve the log; 0 for x <= 0
+    LogFixed sqrt() const {
+        if (is_zero() || neg_) return zero();
+        return from_wide(round_shift(static_cast<int64_t>(log_), 1), false);
+    }
+
+    LogFixed rsqrt() const {
+        if (is_zero() || neg_) return zero();
+        return from_wide(round_shift(-static_cast<int64_t>(log_), 1), false);
+    }
+
+    // Comparisons (ordered by linear value)
+    bool operator==(const LogFixed& rhs) const { return log_ == rhs.log_ && neg_ == rhs.neg_; }
+    bool operator!=(const LogFixed& rhs) const { return !(*this == rhs); }
+
+    bool operator<(const LogFixed& rhs) const {
+        if (neg_ != rhs.neg_) return neg_;
+        return neg_ ? (log_ > rhs.log_) : (log_ < rhs.log_);
+    }
+    bool operator>(const LogFixed& rhs) const  { return rhs < *this; }
+    bool operator<=(const LogFixed& rhs) const { return !(rhs < *this); }
+    bool operator>=(const LogFixed& rhs) const { return !(*this < rhs); }
+};
+
+// Result of FixedPointArray::stats<Mask>(); fields not selected by Mask are 0
+template<int I, int F, typename Backend = ReferenceBackend>
+struct ArrayStats {
+    FixedPoint<I, F, Backend> min, max, sum, mean;
+    FixedPoint<I, F, Backend> power, rms, variance, stddev;
+};
+
+// Result of FixedPointArray::argmin()/argmax()/top_k(): a value and its index
+template<int I, int F, typename Backend = ReferenceBackend>
+struct ArrayExtremum {
+    FixedPoint<I, F, Backend> value;
+    size_t index;
+};
+
+// CRTP base of the lazy array expression nodes (defined after FixedPointArray)
+template<typename E>
+struct ArrayExpr {
+    const E& derived() const { return static_cast<const E&>(*this); }
+};
+
+template<int I, int F, typename E>
+auto as(const ArrayExpr<E>& expr);
+
 // ============================================================================
 // FixedPointArray: Wrapper for arrays of fixed-point values (Option 1 API)
 // ============================================================================
@@ -387,6 +595,17 @@ public:
         return FixedPoint<I, F, Backend>(data_[idx]);
     }
 
+    // Bulk float conversion, element for element the same as FixedPoint(float)
+    // (round to nearest, saturating) and to_float(): from_floats writes the
+    // first min(count, length()) elements, to_floats writes length() floats
+    void from_floats(const float* input, size_t count) {
+        Backend::template array_from_float<total_bits>(input, data_, count < length_ ? count : length_, F);
+    }
+
+    void to_floats(float* output) const {
+        Backend::template array_to_float<total_bits>(data_, output, length_, F);
+    }
+
     // Array operations
     FixedPoint<I, F, Backend> min() const {
         auto result = Backend::template array_min<total_bits>(data_, length_);
@@ -398,6 +617,77 @@ public:
         return FixedPoint<I, F, Backend>(result);
     }
 
+    // Value and index of the first minimum / maximum, in one pass
+    ArrayExtremum<I, F, Backend> argmin() const {
+        Storage value;
+        size_t index = Backend::template array_argmin<total_bits>(data_, length_, value);
+        return ArrayExtremum<I, F, Backend>{FixedPoint<I, F, Backend>(value), index};
+    }
+
+    ArrayExtremum<I, F, Backend> argmax() const {
+        Storage value;
+        size_t index = Backend::template array_argmax<total_bits>(data_, length_, value);
+        return ArrayExtremum<I, F, Backend>{FixedPoint<I, F, Backend>(value), index};
+    }
+
+    // The K largest elements, descending (ties by lower index); returns how
+    // many entries of out were filled, min(K, length())
+    template<size_t K>
+    size_t top_k(ArrayExtremum<I, F, Backend> (&out)[K]) const {
+        static_assert(K > 0, "top_k needs at least one slot");
+        Storage values[K];
+        size_t indices[K];
+        size_t count = Backend::template array_top_k<total_bits>(data_, length_, values, indices, K);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = ArrayExtremum<I, F, Backend>{FixedPoint<I, F, Backend>(values[i]), indices[i]};
+        }
+        return count;
+    }
+
+    // Indices of the local maxima above threshold (flat tops reported once,
+    // end points excluded); writes at most max_peaks and returns the count
+    size_t find_peaks(FixedPoint<I, F, Backend> threshold, size_t* indices, size_t max_peaks) const {
+        return Backend::template array_find_peaks<total_bits>(data_, length_, threshold.raw(),
+                                                              indices, max_peaks);
+    }
+
+    // Element-wise min/max/abs/clip/select (out-of-place, output may alias)
+    void max(const FixedPointArray<I, F, Backend>& other,
+             FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_elemax<total_bits>(data_, other.data(), output.data(), length_);
+    }
+
+    void min(const FixedPointArray<I, F, Backend>& other,
+             FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_elemin<total_bits>(data_, other.data(), output.data(), length_);
+    }
+
+    // Saturating: |min| maps to max
+    void abs(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_abs<total_bits>(data_, output.data(), length_);
+    }
+
+    void clip(FixedPoint<I, F, Backend> lo, FixedPoint<I, F, Backend> hi,
+              FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_clip<total_bits>(data_, output.data(), length_, lo.raw(), hi.raw());
+    }
+
+    // output[i] = this[i] < level ? value : this[i]  (ReLU: level = value = 0)
+    void threshold(FixedPoint<I, F, Backend> level, FixedPoint<I, F, Backend> value,
+                   FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_threshold<total_bits>(data_, output.data(), length_,
+                                                      level.raw(), value.raw());
+    }
+
+    // output[i] = this[i] > level ? above[i] : below[i]
+    void select(FixedPoint<I, F, Backend> level,
+                const FixedPointArray<I, F, Backend>& above,
+                const FixedPointArray<I, F, Backend>& below,
+                FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_select<total_bits>(data_, above.data(), below.data(), output.data(),
+                                                   length_, level.raw());
+    }
+
     // In-place array operations
     void shift(int shift_amount) {
         Backend::template array_shift<total_bits>(data_, length_, shift_amount);
@@ -407,22 +697,178 @@ public:
         Backend::template array_scale<total_bits>(data_, length_, scale_factor.raw(), F);
     }
 
+    // Gain in another Q format (BLAS scal), each element as mul<I, F>; a gain
+    // no wider than the data takes the array_scale path
+    template<int AI, int AF>
+    void scale(FixedPoint<AI, AF, Backend> alpha) {
+        if constexpr (sizeof(Storage_t<AI + AF>) <= sizeof(Storage)) {
+            Backend::template array_scale<total_bits>(data_, length_, static_cast<Storage>(alpha.raw()), AF);
+        } else {
+            Backend::template array_scale_mixed<total_bits, AI + AF, AF>(data_, length_, alpha.raw());
+        }
+    }
+
+    // Fused BLAS level-1 updates, one pass, any Q formats (x.length() elements):
+    //   ir.axpy(mu * err, spk);                    // ir += mu * err * spk
+    //   y.axpby(a, x, b);                          // y = a * x + b * y
+    // Each element is y + alpha.mul<I, F>(x) (resp. a.mul<I, F>(x) +
+    // b.mul<I, F>(y)), rounded and saturated as the scalar expression
+    template<int AI, int AF, int XI, int XF>
+    void axpy(FixedPoint<AI, AF, Backend> alpha, const FixedPointArray<XI, XF, Backend>& x) {
+        Backend::template array_axpy<AI + AF, XI + XF, total_bits, AF + XF - F>(
+            alpha.raw(), x.data(), data_, x.length());
+    }
+
+    template<int AI, int AF, int XI, int XF, int BI, int BF>
+    void axpby(FixedPoint<AI, AF, Backend> alpha, const FixedPointArray<XI, XF, Backend>& x,
+               FixedPoint<BI, BF, Backend> beta) {
+        Backend::template array_axpby<AI + AF, XI + XF, BI + BF, total_bits, AF + XF - F, BF>(
+            alpha.raw(), x.data(), beta.raw(), data_, x.length());
+    }
+
     // Softmax operation (out-of-place, writes to output array)
     void softmax(FixedPointArray<I, F, Backend>& output) const {
         Backend::template softmax<total_bits>(data_, output.data(), length_, F);
     }
 
+    // Element-wise transcendental operations (out-of-place, accuracy tier)
+    // Output formats follow the scalar operations; input and output must not
+    // overlap (NatureDSP restriction)
+
+    // Square root / reciprocal square root (same Q format)
+    template<typename Acc = precise>
+    void sqrt(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_sqrt<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    template<typename Acc = precise>
+    void rsqrt(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_rsqrt<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    // Logarithms (output Q6.25)
+    template<typename Acc = precise>
+    void log2(FixedPointArray<6, 25, Backend>& output) const {
+        Backend::template array_log2<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    template<typename Acc = precise>
+    void logn(FixedPointArray<6, 25, Backend>& output) const {
+        Backend::template array_logn<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    template<typename Acc = precise>
+    void log10(FixedPointArray<6, 25, Backend>& output) const {
+        Backend::template array_log10<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    // Antilogarithms (input interpreted as Q6.25, output Q16.15)
+    template<typename Acc = precise>
+    void antilog2(FixedPointArray<16, 15, Backend>& output) const {
+        Backend::template array_antilog2<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    template<typename Acc = precise>
+    void antilogn(FixedPointArray<16, 15, Backend>& output) const {
+        Backend::template array_antilogn<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    template<typename Acc = precise>
+    void antilog10(FixedPointArray<16, 15, Backend>& output) const {
+        Backend::template array_antilog10<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    // Trigonometric (radians, same Q format)
+    template<typename Acc = precise>
+    void sin(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_sin<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    template<typename Acc = precise>
+    void cos(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_cos<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    template<typename Acc = precise>
+    void atan(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_atan<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    // Reciprocal 1/x (same Q format, saturating)
+    void recip(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_recip<total_bits>(data_, output.data(), length_, F);
+    }
+
+    // Power with a shared exponent: output[i] = this[i]^exponent (same Q format)
+    template<typename Acc = precise, typename Other>
+    void pow(const Other& exponent, FixedPointArray<I, F, Backend>& output) const {
+        constexpr int Yb = Other::total_bits;
+        Backend::template array_pow<total_bits, Yb, Acc>(data_, output.data(), length_,
+                                                         exponent.raw(), F, Other::frac_bits);
+    }
+
+    // Element-wise activations (out-of-place, same Q format, accuracy tier)
+    template<typename Acc = precise>
+    void tanh(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_tanh<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
+    template<typename Acc = precise>
+    void sigmoid(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template array_sigmoid<total_bits, Acc>(data_, output.data(), length_, F);
+    }
+
     // Vector operations (return scalar FixedPoint results)
     FixedPoint<I, F, Backend> dot_product(const FixedPointArray<I, F, Backend>& other) const {
         auto result = Backend::template dot_product<total_bits>(data_, other.data(), length_, F);
         return FixedPoint<I, F, Backend>(result);
     }
 
+    // Mixed-precision dot product: other may have its own width and Q format
+    // (e.g. 32-bit samples with 16-bit filter taps, half the coefficient
+    // bandwidth) and the result any format, Q(I.F) by default:
+    //   auto y = x.dot_product(taps);              // Q(I.F)
+    //   auto e = x.dot_product<8, 24>(taps);       // Q8.24
+    // The sum is exact and rounded once, like dot_product(other)
+    template<int OI = I, int OF = F, int YI, int YF>
+    FixedPoint<OI, OF, Backend> dot_product(const FixedPointArray<YI, YF, Backend>& other) const {
+        auto result = Backend::template dot_product_mixed<total_bits, YI + YF, OI + OF>(
+            data_, other.data(), length_, F + YF - OF);
+        return FixedPoint<OI, OF, Backend>(result);
+    }
+
     FixedPoint<I, F, Backend> sum() const {
         auto result = Backend::template array_sum<total_bits>(data_, length_);
         return FixedPoint<I, F, Backend>(result);
     }
 
+    // Power: sum of squares (saturating, same Q format)
+    FixedPoint<I, F, Backend> power() const {
+        auto result = Backend::template array_power<total_bits>(data_, length_, F);
+        return FixedPoint<I, F, Backend>(result);
+    }
+
+    // Sum of magnitudes and Euclidean norm (BLAS asum / nrm2), exact sums
+    // rounded once into any format, Q(I.F) by default
+    template<int OI = I, int OF = F>
+    FixedPoint<OI, OF, Backend> asum() const {
+        auto result = Backend::template array_asum<total_bits, OI + OF>(data_, length_, F - OF);
+        return FixedPoint<OI, OF, Backend>(result);
+    }
+
+    template<int OI = I, int OF = F>
+    FixedPoint<OI, OF, Backend> nrm2() const {
+        auto result = Backend::template array_nrm2<total_bits, OI + OF>(data_, length_, F, OF);
+        return FixedPoint<OI, OF, Backend>(result);
+    }
+
+    // Fused evaluation of a lazy array expression: y.assign(a * b + c * d)
+    // runs one loop over this array instead of one pass per operator
+    template<typename E>
+    void assign(const ArrayExpr<E>& expr) {
+        Backend::template array_eval<total_bits>(fp::as<I, F>(expr).derived(), data_, length_);
+    }
+
     // Element-wise operations (out-of-place, write to output array)
     void elemult(const FixedPointArray<I, F, Backend>& other,
                  FixedPointArray<I, F, Backend>& output) const {
@@ -439,6 +885,33 @@ public:
         Backend::template array_sub<total_bits>(data_, other.data(), output.data(), length_);
     }
 
+    // Mixed-format element-wise operations: other and output each keep their
+    // own Q format, and the alignment shifts and output rounding happen in
+    // the same loop (no conversion pass). Every element equals the scalar
+    //   a.mul<OI, OF>(b), a.add<OI, OF>(b), a.sub<OI, OF>(b)
+    // e.g. Q1.31 samples times Q5.26 coefficients into Q1.31:
+    //   x.elemult(coeffs, y);
+    template<int YI, int YF, int OI, int OF>
+    void elemult(const FixedPointArray<YI, YF, Backend>& other,
+                 FixedPointArray<OI, OF, Backend>& output) const {
+        Backend::template array_elemult_mixed<total_bits, YI + YF, OI + OF, F + YF - OF>(
+            data_, other.data(), output.data(), length_);
+    }
+
+    template<int YI, int YF, int OI, int OF>
+    void add(const FixedPointArray<YI, YF, Backend>& other,
+             FixedPointArray<OI, OF, Backend>& output) const {
+        Backend::template array_add_mixed<total_bits, YI + YF, OI + OF, F - OF, YF - OF>(
+            data_, other.data(), output.data(), length_);
+    }
+
+    template<int YI, int YF, int OI, int OF>
+    void sub(const FixedPointArray<YI, YF, Backend>& other,
+             FixedPointArray<OI, OF, Backend>& output) const {
+        Backend::template array_sub_mixed<total_bits, YI + YF, OI + OF, F - OF, YF - OF>(
+            data_, other.data(), output.data(), length_);
+    }
+
     // Statistical operations (return scalar results)
     FixedPoint<I, F, Backend> mean() const {
         auto result = Backend::template array_mean<total_bits>(data_, length_, F);
@@ -459,24 +932,1481 @@ public:
         auto result = Backend::template array_stddev<total_bits>(data_, length_, F);
         return FixedPoint<I, F, Backend>(result);
     }
+
+    // Fused statistics in a single pass over the data:
+    //   auto s = x.stats();                               // every field
+    //   auto s = x.stats<stat::mean | stat::stddev>();    // only what is needed
+    template<unsigned Mask = stat::all>
+    ArrayStats<I, F, Backend> stats() const {
+        using Q = FixedPoint<I, F, Backend>;
+        auto r = Backend::template array_stats<total_bits, Mask>(data_, length_, F);
+        return ArrayStats<I, F, Backend>{Q(r.min), Q(r.max), Q(r.sum), Q(r.mean),
+                                         Q(r.power), Q(r.rms), Q(r.variance), Q(r.stddev)};
+    }
+
+    // Execution policy overloads (parallel.hpp): fp::seq is the plain call,
+    // fp::par splits large arrays into cache-sized chunks over a thread pool
+    // (worker threads need FP_ENABLE_THREADS, otherwise the chunks run in
+    // turn). Results are bit-identical to the plain call for any thread count.
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    void elemult(const FixedPointArray<I, F, Backend>& other,
+                 FixedPointArray<I, F, Backend>& output, const Policy& policy) const {
+        for_chunks(policy, [&](size_t begin, size_t n) {
+            Backend::template array_elemult<total_bits>(data_ + begin, other.data() + begin,
+                                                        output.data() + begin, n, F);
+        });
+    }
+
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    void add(const FixedPointArray<I, F, Backend>& other,
+             FixedPointArray<I, F, Backend>& output, const Policy& policy) const {
+        for_chunks(policy, [&](size_t begin, size_t n) {
+            Backend::template array_add<total_bits>(data_ + begin, other.data() + begin,
+                                                    output.data() + begin, n);
+        });
+    }
+
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    void sub(const FixedPointArray<I, F, Backend>& other,
+             FixedPointArray<I, F, Backend>& output, const Policy& policy) const {
+        for_chunks(policy, [&](size_t begin, size_t n) {
+            Backend::template array_sub<total_bits>(data_ + begin, other.data() + begin,
+                                                    output.data() + begin, n);
+        });
+    }
+
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    FixedPoint<I, F, Backend> dot_product(const FixedPointArray<I, F, Backend>& other,
+                                          const Policy& policy) const {
+        if constexpr (std::is_same_v<Policy, sequenced_policy>) {
+            return dot_product(other);
+        } else {
+            auto result = Backend::template parallel_dot_product<total_bits>(policy, data_, other.data(),
+                                                                             length_, F);
+            return FixedPoint<I, F, Backend>(result);
+        }
+    }
+
+    template<unsigned Mask = stat::all, typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    ArrayStats<I, F, Backend> stats(const Policy& policy) const {
+        if constexpr (std::is_same_v<Policy, sequenced_policy>) {
+            return stats<Mask>();
+        } else {
+            using Q = FixedPoint<I, F, Backend>;
+            auto r = Backend::template parallel_array_stats<total_bits, Mask>(policy, data_, length_, F);
+            return ArrayStats<I, F, Backend>{Q(r.min), Q(r.max), Q(r.sum), Q(r.mean),
+                                             Q(r.power), Q(r.rms), Q(r.variance), Q(r.stddev)};
+        }
+    }
+
+    // Single reductions under a policy; the parallel path is the matching
+    // field of the fused pass, which the reference kernels compute the same way
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    FixedPoint<I, F, Backend> sum(const Policy& policy) const {
+        if constexpr (serial_policy<Policy>()) return sum();
+        else return stats<stat::sum>(policy).sum;
+    }
+
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    FixedPoint<I, F, Backend> power(const Policy& policy) const {
+        if constexpr (serial_policy<Policy>()) return power();
+        else return stats<stat::power>(policy).power;
+    }
+
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    FixedPoint<I, F, Backend> mean(const Policy& policy) const {
+        if constexpr (serial_policy<Policy>()) return mean();
+        else return stats<stat::mean>(policy).mean;
+    }
+
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    FixedPoint<I, F, Backend> rms(const Policy& policy) const {
+        if constexpr (serial_policy<Policy>()) return rms();
+        else return stats<stat::rms>(policy).rms;
+    }
+
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    FixedPoint<I, F, Backend> variance(const Policy& policy) const {
+        if constexpr (serial_policy<Policy>()) return variance();
+        else return stats<stat::variance>(policy).variance;
+    }
+
+    template<typename Policy, EnableIf<is_execution_policy<Policy>::value> = 0>
+    FixedPoint<I, F, Backend> stddev(const Policy& policy) const {
+        if constexpr (serial_policy<Policy>()) return stddev();
+        else return stats<stat::stddev>(policy).stddev;
+    }
+
+private:
+    // Policies that run on the calling thread: fp::seq, and fp::par on
+    // builds without worker threads (which keeps the backend's own kernels)
+    template<typename Policy>
+    static constexpr bool serial_policy() {
+        return std::is_same_v<Policy, sequenced_policy> || !FP_HAS_THREADS;
+    }
+
+    // body(begin, length) over the policy's chunks, or once over the whole array
+    template<typename Policy, typename Body>
+    void for_chunks(const Policy& policy, Body&& body) const {
+        if constexpr (std::is_same_v<Policy, parallel_policy>) {
+            if (detail::parallel_chunks(policy, length_, sizeof(Storage), body)) return;
+        }
+        body(size_t(0), length_);
+    }
 };
 
 // Short alias for FixedPointArray
 template<int I, int F, typename Backend = ReferenceBackend>
 using q_array = FixedPointArray<I, F, Backend>;
 
-// ---------- Free helpers (no ambiguous operator overloads) ----------
+// Q-format conversion between arrays (BLAS copy with a format change):
+// out[i] = in[i] in Q(OI.OF), rounded half away from zero and saturated, for
+// any pair of 8/16/32-bit formats (narrowing, widening, same bucket). The
+// shift is a compile-time constant; values match out.assign(fp::as<OI, OF>(in)).
+// Converts in.length() elements; in and out may be the same array when the
+// storage type matches.
+template<int I, int F, int OI, int OF, typename Backend>
+inline void convert(const FixedPointArray<I, F, Backend>& in, FixedPointArray<OI, OF, Backend>& out)
+{
+    Backend::template array_convert<I + F, OI + OF, OF - F>(in.data(), out.data(), in.length());
+}
 
-// Explicit result format helper: fp::mul_as<OUT_I,OUT_F>(a,b)
-template<int OUT_I, int OUT_F, typename QA, typename QB>
-auto mul_as(const QA& a, const QB& b) {
-    return a.template mul<OUT_I, OUT_F>(b);
+// Raw coefficient with CF fractional bits, rounded half away from zero, for
+// fp::poly's template arguments (C++17 has no floating-point ones)
+template<int CF>
+constexpr int64_t poly_coef(double v)
+{
+    double scaled = v * detail::poly_pow2(CF);
+    return static_cast<int64_t>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
 }
 
-// Explicit result format helper: fp::div_as<OUT_I,OUT_F>(a,b)
-template<int OUT_I, int OUT_F, typename QA, typename QB>
-auto div_as(const QA& a, const QB& b) {
-    return a.template div<OUT_I, OUT_F>(b);
+// Polynomial with compile-time coefficients, c0 first, as raw values with CF
+// fractional bits: out[i] = c0 + c1 * x[i] + ... + cn * x[i]^n, in out's Q
+// format (rounded, saturated). Calibration and nonlinearity curves:
+//   constexpr int64_t c0 = fp::poly_coef<30>(0.02), c1 = fp::poly_coef<30>(0.97),
+//                     c2 = fp::poly_coef<30>(-0.11);
+//   fp::poly<30, c0, c1, c2>(x, y);
+// Horner's rule in 64 bits; the fractional bits of every stage are chosen at
+// compile time from the coefficients and x's range, so no stage overflows
+// and each rounds once (backends/reference/vector_poly.hpp). 32-bit data up
+// to degree 8 runs NatureDSP vec_poly4/8_32x32 on Xtensa when its output
+// shift is small enough to bound the error (NdspPolyPlan::max_error_lsb,
+// at most (degree + 1/2) * 4 LSB); overlapping x and out use the reference
+// kernel there. Evaluates x.length() elements.
+template<int CF, int64_t... C, int I, int F, int OI, int OF, typename Backend>
+inline void poly(const FixedPointArray<I, F, Backend>& x, FixedPointArray<OI, OF, Backend>& out)
+{
+    Backend::template array_poly<I + F, OI + OF, F, OF, CF, C...>(x.data(), out.data(), x.length());
+}
+
+// ============================================================================
+// Lazy array expressions: loop-fused element-wise arithmetic
+// ============================================================================
+//
+// Arithmetic on FixedPointArray operands builds an expression tree instead of
+// running a pass per operator; y.assign(a * b + c * d) evaluates the whole
+// tree in one loop over y, with no temporaries and no intermediate stores.
+//
+// Every node has a compile-time Q format and the rounding/saturation of the
+// eager operation it replaces, so a fused expression is bit-identical to the
+// equivalent elemult/add/sub/scale sequence. As with FixedPoint, the result
+// takes the format of the left operand:
+//   - a + b, a - b:    rhs aligned to lhs fractional bits (rounded), saturating
+//   - a * b:           product shifted by rhs fractional bits (array_elemult;
+//                      array_scale when b is a FixedPoint gain), saturating
+//   - -a:              saturating negation
+//   - fp::as<I,F>(a):  explicit conversion (rounded shift, saturating)
+// Operands are arrays, expressions or FixedPoint scalars broadcast to every
+// element (scalars on the right: FixedPoint's own operators take the left).
+// assign() converts to the destination format and evaluates output.length()
+// elements; element i only reads index i, so the destination may alias an
+// operand.
+
+namespace detail {
+
+template<int I, int F, typename Backend>
+struct ExprFormat {
+    static constexpr int int_bits = I;
+    static constexpr int frac_bits = F;
+    static constexpr int total_bits = I + F;
+    using backend = Backend;
+};
+
+// Saturate a wide intermediate to the storage range of a Bits-wide format
+template<int Bits>
+inline long long expr_saturate(long long v) {
+    return static_cast<long long>(sat_cast<Storage_t<Bits>>(v));
+}
+
+// Leaf: array operand
+template<int I, int F, typename Backend>
+struct ExprArray : ArrayExpr<ExprArray<I, F, Backend>>, ExprFormat<I, F, Backend> {
+    const Storage_t<I + F>* data;
+    explicit ExprArray(const Storage_t<I + F>* d) : data(d) {}
+    long long operator[](size_t i) const { return data[i]; }
+};
+
+// Leaf: strided array operand (StridedArray, MatrixView rows and columns)
+template<int I, int F, typename Backend>
+struct ExprStrided : ArrayExpr<ExprStrided<I, F, Backend>>, ExprFormat<I, F, Backend> {
+    const Storage_t<I + F>* data;
+    ptrdiff_t stride;
+    ExprStrided(const Storage_t<I + F>* d, ptrdiff_t s) : data(d), stride(s) {}
+    long long operator[](size_t i) const { return data[static_cast<ptrdiff_t>(i) * stride]; }
+};
+
+// Leaf: FixedPoint scalar broadcast to every element
+template<int I, int F, typename Backend>
+struct ExprScalar : ArrayExpr<ExprScalar<I, F, Backend>>, ExprFormat<I, F, Backend> {
+    long long value;
+    explicit ExprScalar(long long v) : value(v) {}
+    long long operator[](size_t) const { return value; }
+};
+
+template<typename L, typename R>
+struct ExprAdd : ArrayExpr<ExprAdd<L, R>>,
+                 ExprFormat<L::int_bits, L::frac_bits, typename L::backend> {
+    L lhs; R rhs;
+    ExprAdd(const L& l, const R& r) : lhs(l), rhs(r) {}
+    long long operator[](size_t i) const {
+        return expr_saturate<L::total_bits>(lhs[i] + round_shift(rhs[i], R::frac_bits - L::frac_bits));
+    }
+};
+
+template<typename L, typename R>
+struct ExprSub : ArrayExpr<ExprSub<L, R>>,
+                 ExprFormat<L::int_bits, L::frac_bits, typename L::backend> {
+    L lhs; R rhs;
+    ExprSub(const L& l, const R& r) : lhs(l), rhs(r) {}
+    long long operator[](size_t i) const {
+        return expr_saturate<L::total_bits>(lhs[i] - round_shift(rhs[i], R::frac_bits - L::frac_bits));
+    }
+};
+
+template<typename L, typename R>
+struct ExprMul : ArrayExpr<ExprMul<L, R>>,
+                 ExprFormat<L::int_bits, L::frac_bits, typename L::backend> {
+    L lhs; R rhs;
+    ExprMul(const L& l, const R& r) : lhs(l), rhs(r) {}
+    long long operator[](size_t i) const {
+        return expr_saturate<L::total_bits>(round_shift(lhs[i] * rhs[i], R::frac_bits));
+    }
+};
+
+template<typename E>
+struct ExprNeg : ArrayExpr<ExprNeg<E>>,
+                 ExprFormat<E::int_bits, E::frac_bits, typename E::backend> {
+    E arg;
+    explicit ExprNeg(const E& e) : arg(e) {}
+    long long operator[](size_t i) const { return expr_saturate<E::total_bits>(-arg[i]); }
+};
+
+template<int I, int F, typename E>
+struct ExprConvert : ArrayExpr<ExprConvert<I, F, E>>,
+                     ExprFormat<I, F, typename E::backend> {
+    E arg;
+    explicit ExprConvert(const E& e) : arg(e) {}
+    long long operator[](size_t i) const {
+        return expr_saturate<I + F>(round_shift(arg[i], E::frac_bits - F));
+    }
+};
+
+// Operand -> node mapping: arrays and scalars become leaves, nodes pass through
+template<typename T, typename = void>
+struct ExprOperand {
+    static constexpr bool value = false;
+    static constexpr bool is_array = false;
+};
+
+template<typename T>
+struct ExprOperand<T, std::enable_if_t<std::is_base_of_v<ArrayExpr<T>, T>>> {
+    static constexpr bool value = true;
+    static constexpr bool is_array = true;
+    static const T& wrap(const T& e) { return e; }
+};
+
+template<int I, int F, typename Backend>
+struct ExprOperand<FixedPointArray<I, F, Backend>> {
+    static constexpr bool value = true;
+    static constexpr bool is_array = true;
+    static ExprArray<I, F, Backend> wrap(const FixedPointArray<I, F, Backend>& a) {
+        return ExprArray<I, F, Backend>(a.data());
+    }
+};
+
+template<int I, int F, typename Backend>
+struct ExprOperand<FixedPoint<I, F, Backend>> {
+    static constexpr bool value = true;
+    static constexpr bool is_array = false;
+    static ExprScalar<I, F, Backend> wrap(const FixedPoint<I, F, Backend>& x) {
+        return ExprScalar<I, F, Backend>(x.raw());
+    }
+};
+
+template<typename T>
+using expr_node_t = std::decay_t<decltype(ExprOperand<T>::wrap(std::declval<const T&>()))>;
+
+// Binary operators apply when the lhs is array-valued and the rhs is any operand
+template<typename L, typename R>
+struct ExprBinary {
+    static constexpr bool value = ExprOperand<L>::value && ExprOperand<R>::value &&
+                                  ExprOperand<L>::is_array;
+};
+
+template<typename L, typename R>
+using ExprBinaryEnable = std::enable_if_t<ExprBinary<L, R>::value, int>;
+
+template<template<typename, typename> class Node, typename L, typename R>
+auto make_expr(const L& l, const R& r) {
+    using LN = expr_node_t<L>;
+    using RN = expr_node_t<R>;
+    static_assert(std::is_same_v<typename LN::backend, typename RN::backend>,
+                  "array expression operands must use the same backend");
+    return Node<LN, RN>(ExprOperand<L>::wrap(l), ExprOperand<R>::wrap(r));
+}
+
+} // namespace detail
+
+template<typename L, typename R, detail::ExprBinaryEnable<L, R> = 0>
+auto operator+(const L& lhs, const R& rhs) { return detail::make_expr<detail::ExprAdd>(lhs, rhs); }
+
+template<typename L, typename R, detail::ExprBinaryEnable<L, R> = 0>
+auto operator-(const L& lhs, const R& rhs) { return detail::make_expr<detail::ExprSub>(lhs, rhs); }
+
+template<typename L, typename R, detail::ExprBinaryEnable<L, R> = 0>
+auto operator*(const L& lhs, const R& rhs) { return detail::make_expr<detail::ExprMul>(lhs, rhs); }
+
+template<typename E, std::enable_if_t<detail::ExprOperand<E>::value &&
+                                      detail::ExprOperand<E>::is_array, int> = 0>
+auto operator-(const E& arg) {
+    return detail::ExprNeg<detail::expr_node_t<E>>(detail::ExprOperand<E>::wrap(arg));
+}
+
+// Explicit Q-format conversion of an array expression: fp::as<1,31>(a * b)
+template<int I, int F, typename E>
+auto as(const ArrayExpr<E>& expr) {
+    return detail::ExprConvert<I, F, E>(expr.derived());
+}
+
+template<int I, int F, int XI, int XF, typename Backend>
+auto as(const FixedPointArray<XI, XF, Backend>& arr) {
+    return fp::as<I, F>(detail::ExprArray<XI, XF, Backend>(arr.data()));
+}
+
+// ============================================================================
+// StridedArray: 1-D view with an element stride
+// ============================================================================
+//
+// Element i is data()[i * stride()] (stride in elements, may be negative), so
+// one channel of an interleaved buffer, every Nth bin or a matrix column can
+// be processed in place, without a deinterleave copy:
+//
+//   int16_t stereo[2 * 256];
+//   fp::StridedArray<1, 15> left(stereo, 256, 2), right(stereo + 1, 256, 2);
+//   auto e = left.power();                     // reductions read in place
+//   right.assign(fp::as<1, 15>(left * gain));  // expressions read and write in place
+//   left.transform(left, [](const auto& in, auto& out) { in.tanh(out); });
+//
+// The backend dispatches on the stride once per call: unit stride runs the
+// contiguous kernels, strides 2 and 4 get compile-time strided loops, other
+// strides a generic loop. Reductions and expressions work on the view
+// directly; any other FixedPointArray operation runs through transform(),
+// which stages CHUNK elements at a time in contiguous buffers on the stack
+// (or calls the operation on the whole view when both strides are 1).
+
+template<int I, int F, typename Backend = ReferenceBackend>
+class StridedArray {
+public:
+    static constexpr int int_bits = I;
+    static constexpr int frac_bits = F;
+    static constexpr int total_bits = I + F;
+    using Storage = Storage_t<total_bits>;
+
+    // Elements staged per transform() step
+    static constexpr size_t CHUNK = 64;
+
+    StridedArray(Storage* data, size_t length, ptrdiff_t stride = 1)
+        : data_(data), length_(length), stride_(stride) {}
+
+    // A contiguous array is a unit-stride view
+    StridedArray(FixedPointArray<I, F, Backend>& arr)
+        : data_(arr.data()), length_(arr.length()), stride_(1) {}
+
+    Storage* data() const { return data_; }
+    size_t length() const { return length_; }
+    ptrdiff_t stride() const { return stride_; }
+    bool is_contiguous() const { return stride_ == 1; }
+
+    FixedPoint<I, F, Backend> operator[](size_t idx) const {
+        return FixedPoint<I, F, Backend>(data_[static_cast<ptrdiff_t>(idx) * stride_]);
+    }
+
+    void set(size_t idx, FixedPoint<I, F, Backend> value) {
+        data_[static_cast<ptrdiff_t>(idx) * stride_] = value.raw();
+    }
+
+    // length elements starting at element offset, taking every step-th one
+    StridedArray subview(size_t offset, size_t length, ptrdiff_t step = 1) const {
+        return StridedArray(data_ + static_cast<ptrdiff_t>(offset) * stride_, length, stride_ * step);
+    }
+
+    // Contiguous view; only meaningful when is_contiguous()
+    FixedPointArray<I, F, Backend> contiguous() const {
+        return FixedPointArray<I, F, Backend>(data_, length_);
+    }
+
+    // Copies to and from contiguous storage
+    void gather(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template strided_gather<total_bits>(data_, stride_, output.data(), length_);
+    }
+
+    void scatter(const FixedPointArray<I, F, Backend>& input) {
+        Backend::template strided_scatter<total_bits>(input.data(), data_, stride_, length_);
+    }
+
+    void fill(FixedPoint<I, F, Backend> value) {
+        Backend::template strided_fill<total_bits>(data_, stride_, length_, value.raw());
+    }
+
+    // Fused evaluation of a lazy array expression into this view
+    template<typename E>
+    void assign(const ArrayExpr<E>& expr) {
+        Backend::template strided_eval<total_bits>(fp::as<I, F>(expr).derived(), data_, stride_, length_);
+    }
+
+    // Run an element-wise FixedPointArray operation on the view:
+    //   op(const FixedPointArray<I, F>& in, FixedPointArray<OI, OF>& out)
+    // The output may be this view (in-place) or any view of the same length.
+    template<int OI, int OF, typename Op>
+    void transform(StridedArray<OI, OF, Backend> output, Op op) const {
+        using OutStorage = Storage_t<OI + OF>;
+        if (stride_ == 1 && output.stride() == 1) {
+            FixedPointArray<I, F, Backend> in(data_, length_);
+            FixedPointArray<OI, OF, Backend> out(output.data(), length_);
+            op(static_cast<const FixedPointArray<I, F, Backend>&>(in), out);
+            return;
+        }
+
+        Storage in_buf[CHUNK];
+        OutStorage out_buf[CHUNK];
+        for (size_t start = 0; start < length_; start += CHUNK) {
+            size_t n = (length_ - start < CHUNK) ? length_ - start : CHUNK;
+            FixedPointArray<I, F, Backend> in(in_buf, n);
+            FixedPointArray<OI, OF, Backend> out(out_buf, n);
+            subview(start, n).gather(in);
+            op(static_cast<const FixedPointArray<I, F, Backend>&>(in), out);
+            output.subview(start, n).scatter(out);
+        }
+    }
+
+    // Reductions, read in place (same results as the contiguous kernels)
+    FixedPoint<I, F, Backend> min() const { return stat_field<stat::min>().min; }
+    FixedPoint<I, F, Backend> max() const { return stat_field<stat::max>().max; }
+    FixedPoint<I, F, Backend> sum() const { return stat_field<stat::sum>().sum; }
+    FixedPoint<I, F, Backend> mean() const { return stat_field<stat::mean>().mean; }
+    FixedPoint<I, F, Backend> power() const { return stat_field<stat::power>().power; }
+    FixedPoint<I, F, Backend> rms() const { return stat_field<stat::rms>().rms; }
+    FixedPoint<I, F, Backend> variance() const { return stat_field<stat::variance>().variance; }
+    FixedPoint<I, F, Backend> stddev() const { return stat_field<stat::stddev>().stddev; }
+
+    template<unsigned Mask = stat::all>
+    ArrayStats<I, F, Backend> stats() const { return stat_field<Mask>(); }
+
+    ArrayExtremum<I, F, Backend> argmin() const {
+        Storage value;
+        size_t index = Backend::template strided_argmin<total_bits>(data_, stride_, length_, value);
+        return ArrayExtremum<I, F, Backend>{FixedPoint<I, F, Backend>(value), index};
+    }
+
+    ArrayExtremum<I, F, Backend> argmax() const {
+        Storage value;
+        size_t index = Backend::template strided_argmax<total_bits>(data_, stride_, length_, value);
+        return ArrayExtremum<I, F, Backend>{FixedPoint<I, F, Backend>(value), index};
+    }
+
+    FixedPoint<I, F, Backend> dot_product(const StridedArray& other) const {
+        auto result = Backend::template strided_dot<total_bits>(data_, stride_, other.data(), other.stride(),
+                                                                length_, F);
+        return FixedPoint<I, F, Backend>(result);
+    }
+
+private:
+    template<unsigned Mask>
+    ArrayStats<I, F, Backend> stat_field() const {
+        using Q = FixedPoint<I, F, Backend>;
+        auto r = Backend::template strided_stats<total_bits, Mask>(data_, stride_, length_, F);
+        return ArrayStats<I, F, Backend>{Q(r.min), Q(r.max), Q(r.sum), Q(r.mean),
+                                         Q(r.power), Q(r.rms), Q(r.variance), Q(r.stddev)};
+    }
+
+    Storage* data_;
+    size_t length_;
+    ptrdiff_t stride_;
+};
+
+namespace detail {
+
+template<int I, int F, typename Backend>
+struct ExprOperand<StridedArray<I, F, Backend>> {
+    static constexpr bool value = true;
+    static constexpr bool is_array = true;
+    static ExprStrided<I, F, Backend> wrap(const StridedArray<I, F, Backend>& a) {
+        return ExprStrided<I, F, Backend>(a.data(), a.stride());
+    }
+};
+
+} // namespace detail
+
+template<int I, int F, int XI, int XF, typename Backend>
+auto as(const StridedArray<XI, XF, Backend>& arr) {
+    return fp::as<I, F>(detail::ExprStrided<XI, XF, Backend>(arr.data(), arr.stride()));
+}
+
+// ============================================================================
+// MatrixView: 2-D view over row-major or column-major storage
+// ============================================================================
+//
+// rows x cols elements at data()[r * row_stride() + c * col_stride()]. Rows and
+// columns are StridedArrays, so every 1-D operation applies to them; in a
+// row-major matrix a row has unit stride and takes the contiguous fast path,
+// a column is strided by the leading dimension (and vice versa):
+//
+//   int32_t buf[8 * 16];
+//   auto m = fp::MatrixView<1, 31>::row_major(buf, 8, 16);
+//   auto e = m.row(3).power();                 // contiguous
+//   auto c = m.col(5).mean();                  // stride 16
+//   auto t = m.transpose();                    // no copy
+//
+// A packed matrix (no gaps between rows / columns) is also one contiguous
+// array: flat() returns it for whole-matrix element-wise operations.
+
+template<int I, int F, typename Backend = ReferenceBackend>
+class MatrixView {
+public:
+    static constexpr int total_bits = I + F;
+    using Storage = Storage_t<total_bits>;
+
+    MatrixView(Storage* data, size_t rows, size_t cols, ptrdiff_t row_stride, ptrdiff_t col_stride)
+        : data_(data), rows_(rows), cols_(cols), row_stride_(row_stride), col_stride_(col_stride) {}
+
+    // ld: leading dimension, elements between rows (row-major) or columns
+    // (column-major); 0 means packed
+    static MatrixView row_major(Storage* data, size_t rows, size_t cols, size_t ld = 0) {
+        return MatrixView(data, rows, cols, static_cast<ptrdiff_t>(ld ? ld : cols), 1);
+    }
+
+    static MatrixView col_major(Storage* data, size_t rows, size_t cols, size_t ld = 0) {
+        return MatrixView(data, rows, cols, 1, static_cast<ptrdiff_t>(ld ? ld : rows));
+    }
+
+    Storage* data() const { return data_; }
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+    ptrdiff_t row_stride() const { return row_stride_; }
+    ptrdiff_t col_stride() const { return col_stride_; }
+
+    FixedPoint<I, F, Backend> operator()(size_t r, size_t c) const {
+        return FixedPoint<I, F, Backend>(data_[offset(r, c)]);
+    }
+
+    void set(size_t r, size_t c, FixedPoint<I, F, Backend> value) { data_[offset(r, c)] = value.raw(); }
+
+    StridedArray<I, F, Backend> row(size_t r) const {
+        return StridedArray<I, F, Backend>(data_ + offset(r, 0), cols_, col_stride_);
+    }
+
+    StridedArray<I, F, Backend> col(size_t c) const {
+        return StridedArray<I, F, Backend>(data_ + offset(0, c), rows_, row_stride_);
+    }
+
+    // Main diagonal
+    StridedArray<I, F, Backend> diag() const {
+        return StridedArray<I, F, Backend>(data_, rows_ < cols_ ? rows_ : cols_, row_stride_ + col_stride_);
+    }
+
+    MatrixView transpose() const { return MatrixView(data_, cols_, rows_, col_stride_, row_stride_); }
+
+    MatrixView block(size_t r0, size_t c0, size_t rows, size_t cols) const {
+        return MatrixView(data_ + offset(r0, c0), rows, cols, row_stride_, col_stride_);
+    }
+
+    // True when the elements form one gap-free run (row- or column-major)
+    bool is_packed() const {
+        return (col_stride_ == 1 && row_stride_ == static_cast<ptrdiff_t>(cols_)) ||
+               (row_stride_ == 1 && col_stride_ == static_cast<ptrdiff_t>(rows_));
+    }
+
+    // The whole matrix as one array; only meaningful when is_packed()
+    FixedPointArray<I, F, Backend> flat() const {
+        return FixedPointArray<I, F, Backend>(data_, rows_ * cols_);
+    }
+
+private:
+    ptrdiff_t offset(size_t r, size_t c) const {
+        return static_cast<ptrdiff_t>(r) * row_stride_ + static_cast<ptrdiff_t>(c) * col_stride_;
+    }
+
+    Storage* data_;
+    size_t rows_, cols_;
+    ptrdiff_t row_stride_, col_stride_;
+};
+
+// ============================================================================
+// BatchView: many small vectors in transposed (SoA) layout
+// ============================================================================
+//
+// count() vectors of length() elements each, element j of vector k at
+// data()[j * ld() + k]: row j holds element j of every vector. Per-bin
+// adaptive filters and small beamformer weights run thousands of length
+// 4..16 dot products and norms per block; one call per vector is all call
+// and loop overhead, while the batch kernels run their inner loop across the
+// vectors, so SIMD lanes cover the batch instead of the tiny length:
+//
+//   int16_t w[8 * 256], x[8 * 256], y[256];
+//   fp::BatchView<1, 15> W(w, 256, 8), X(x, 256, 8);
+//   fp::FixedPointArray<1, 15> out(y, 256);
+//   W.dot(X, out);                             // out[k] = dot(w_k, x_k)
+//   W.axpy(mu, X);                             // w_k += mu[k] * x_k
+//
+// dot and power are the exact sum of products rounded once (half away from
+// zero) and saturated, norm is the rounded square root of the exact sum of
+// squares, and axpy rounds and saturates each product and sum like
+// y + mu * x on FixedPoint. vector(k) is a strided view of one vector
+// (gather / scatter pack and unpack it); row(j) is contiguous.
+
+template<int I, int F, typename Backend = ReferenceBackend>
+class BatchView {
+public:
+    static constexpr int total_bits = I + F;
+    using Storage = Storage_t<total_bits>;
+
+    // ld: elements between rows, at least count; 0 means packed
+    BatchView(Storage* data, size_t count, size_t length, size_t ld = 0)
+        : data_(data), count_(count), length_(length), ld_(ld ? ld : count) {}
+
+    Storage* data() const { return data_; }
+    size_t count() const { return count_; }
+    size_t length() const { return length_; }
+    size_t ld() const { return ld_; }
+
+    StridedArray<I, F, Backend> vector(size_t k) const {
+        return StridedArray<I, F, Backend>(data_ + k, length_, static_cast<ptrdiff_t>(ld_));
+    }
+
+    // Element j of every vector
+    FixedPointArray<I, F, Backend> row(size_t j) const {
+        return FixedPointArray<I, F, Backend>(data_ + j * ld_, count_);
+    }
+
+    // Vectors [k0, k0 + count)
+    BatchView block(size_t k0, size_t count) const { return BatchView(data_ + k0, count, length_, ld_); }
+
+    // length() x count() row-major matrix, one vector per column
+    MatrixView<I, F, Backend> matrix() const {
+        return MatrixView<I, F, Backend>::row_major(data_, length_, count_, ld_);
+    }
+
+    // Per-vector reductions into output[0, count()); other has the same shape
+    void dot(const BatchView& other, FixedPointArray<I, F, Backend>& output) const {
+        Backend::template batch_dot<total_bits>(data_, ld_, other.data(), other.ld(),
+                                                count_, length_, output.data(), F);
+    }
+
+    // Sum of squares, as FixedPointArray::power()
+    void power(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template batch_power<total_bits>(data_, ld_, count_, length_, output.data(), F);
+    }
+
+    // Euclidean norm sqrt(sum of squares), rounded once
+    void norm(FixedPointArray<I, F, Backend>& output) const {
+        Backend::template batch_norm<total_bits>(data_, ld_, count_, length_, output.data(), F);
+    }
+
+    // this_k += alpha[k] * x_k, each element as y + alpha * x on FixedPoint
+    void axpy(const FixedPointArray<I, F, Backend>& alpha, const BatchView& x) {
+        Backend::template batch_axpy<total_bits>(alpha.data(), x.data(), x.ld(), data_, ld_,
+                                                 count_, length_, F);
+    }
+
+private:
+    Storage* data_;
+    size_t count_, length_, ld_;
+};
+
+// ============================================================================
+// Interleaved <-> planar conversion
+// ============================================================================
+//
+// Multichannel blocks arrive interleaved (frame f of channel c at
+// data[f * channels + c]) while every FixedPointArray operation wants one
+// contiguous plane per channel. deinterleave() / interleave() move between
+// the layouts in one pass and convert the Q format on the way, with the
+// values of fp::convert (rounded half away from zero, saturated; a plain
+// copy when the formats match):
+//
+//   int16_t pcm[2 * 256];                          // stereo Q1.15
+//   int32_t l[256], r[256];
+//   fp::FixedPointArray<1, 15> in(pcm, 2 * 256);
+//   fp::FixedPointArray<1, 31> planes[2] = {{l, 256}, {r, 256}};
+//   fp::deinterleave(in, planes, 2);               // -> Q1.31 planes
+//   ...
+//   fp::interleave(planes, 2, in);                 // and back, rounded
+//
+// The frame count is the interleaved length / channels; every plane holds at
+// least that many elements. 2, 4 and 8 channels run fixed-stride vector
+// loops; wider layouts go INTERLEAVE_GROUP channels per pass. Blocks kept as
+// matrices (a planar buffer with a leading dimension, a sub-block, reversed
+// strides) use convert() on two MatrixViews, the general AoS <-> SoA
+// transposer:
+//
+//   auto aos = fp::MatrixView<1, 15>::row_major(pcm, 256, 2);    // frames x channels
+//   auto soa = fp::MatrixView<1, 31>::col_major(planar, 256, 2, 264);
+//   fp::convert(aos, soa);
+
+// Channels per backend call
+inline constexpr size_t INTERLEAVE_GROUP = 8;
+
+template<int I, int F, int OI, int OF, typename Backend>
+inline void deinterleave(const FixedPointArray<I, F, Backend>& in, FixedPointArray<OI, OF, Backend>* planes,
+                         size_t channels)
+{
+    if (channels == 0) return;
+    const size_t frames = in.length() / channels;
+    Storage_t<OI + OF>* group[INTERLEAVE_GROUP];
+    for (size_t c0 = 0; c0 < channels; c0 += INTERLEAVE_GROUP) {
+        size_t n = (channels - c0 < INTERLEAVE_GROUP) ? channels - c0 : INTERLEAVE_GROUP;
+        for (size_t c = 0; c < n; ++c) group[c] = planes[c0 + c].data();
+        Backend::template array_deinterleave<I + F, OI + OF, OF - F>(in.data() + c0, channels, group, n, frames);
+    }
+}
+
+template<int I, int F, int OI, int OF, typename Backend>
+inline void interleave(const FixedPointArray<I, F, Backend>* planes, size_t channels,
+                       FixedPointArray<OI, OF, Backend>& out)
+{
+    if (channels == 0) return;
+    const size_t frames = out.length() / channels;
+    const Storage_t<I + F>* group[INTERLEAVE_GROUP];
+    for (size_t c0 = 0; c0 < channels; c0 += INTERLEAVE_GROUP) {
+        size_t n = (channels - c0 < INTERLEAVE_GROUP) ? channels - c0 : INTERLEAVE_GROUP;
+        for (size_t c = 0; c < n; ++c) group[c] = planes[c0 + c].data();
+        Backend::template array_interleave<I + F, OI + OF, OF - F>(group, out.data() + c0, channels, n, frames);
+    }
+}
+
+// Converting copy between any two layouts of the same rows x cols shape;
+// a transpose when one view is row-major and the other column-major. The
+// views must not overlap
+template<int I, int F, int OI, int OF, typename Backend>
+inline void convert(const MatrixView<I, F, Backend>& in, MatrixView<OI, OF, Backend> out)
+{
+    Backend::template matrix_convert<I + F, OI + OF, OF - F>(in.data(), in.row_stride(), in.col_stride(),
+                                                             out.data(), out.row_stride(), out.col_stride(),
+                                                             in.rows(), in.cols());
+}
+
+// ============================================================================
+// SlidingWindowStats: O(1) running statistics over the last N samples
+// ============================================================================
+//
+// Keeps the last N samples plus an exact running sum and sum of squares
+// (the reduction engine accumulators: 64-bit, split 96-bit for 32x32
+// squares), so every push is one add and one subtract instead of a pass over
+// the window. Derived statistics round once, like FixedPointArray::stats().
+// With TrackMinMax, min/max come from monotonic deques (amortized O(1)).
+//
+// Statistics cover the samples currently in the window (size()); reset(x)
+// fills the whole window with x, e.g. zeros for a mean over a fixed length:
+//
+//   fp::SlidingWindowStats<5, 26, 64> energy;   // energy.reset() -> 64 zeros
+//   energy.push(e);
+//   auto m = energy.mean();
+
+template<int I, int F, size_t N, bool TrackMinMax = false, typename Backend = ReferenceBackend>
+class SlidingWindowStats {
+    static_assert(N > 0, "window length must be positive");
+
+public:
+    using value_type = FixedPoint<I, F, Backend>;
+    using Storage = Storage_t<I + F>;
+    static constexpr size_t capacity = N;
+
+    SlidingWindowStats() { clear(); }
+
+    // Empty window
+    void clear() {
+        count_ = 0;
+        seq_ = 0;
+        sum_ = detail::ReduceAcc64{};
+        sum_sq_ = SquareAcc{};
+        min_q_.clear();
+        max_q_.clear();
+    }
+
+    // Full window of copies of value
+    void reset(value_type value = value_type()) {
+        clear();
+        for (size_t i = 0; i < N; ++i) push(value);
+    }
+
+    // Append one sample, evicting the oldest once the window is full
+    void push(value_type value) { push_raw(value.raw()); }
+
+    void push_raw(Storage x) {
+        size_t slot = static_cast<size_t>(seq_ % N);
+        if (count_ == N) {
+            int64_t old = window_[slot];
+            sum_.add(-old);
+            sum_sq_.add(-(old * old));
+        } else {
+            ++count_;
+        }
+
+        int64_t v = x;
+        window_[slot] = x;
+        sum_.add(v);
+        sum_sq_.add(v * v);
+        sum_sq_.normalize();
+
+        if constexpr (TrackMinMax) {
+            min_q_.push(seq_, window_, [](Storage a, Storage b) { return a <= b; });
+            max_q_.push(seq_, window_, [](Storage a, Storage b) { return a >= b; });
+        }
+        ++seq_;
+    }
+
+    // Block update: only the last N samples of a long block can stay in the
+    // window, so longer blocks restart from their tail
+    void push_block(const Storage* data, size_t length) {
+        if (length >= N) {
+            clear();
+            data += length - N;
+            length = N;
+        }
+        for (size_t i = 0; i < length; ++i) push_raw(data[i]);
+    }
+
+    template<int XI, int XF>
+    void push_block(const FixedPointArray<XI, XF, Backend>& block) {
+        static_assert(XI == I && XF == F, "block must be in the window Q format");
+        push_block(block.data(), block.length());
+    }
+
+    size_t size() const { return count_; }
+    bool full() const { return count_ == N; }
+    bool empty() const { return count_ == 0; }
+
+    // Most recent sample (window must not be empty)
+    value_type back() const { return value_type(window_[static_cast<size_t>((seq_ - 1) % N)]); }
+
+    // Running statistics (saturating, window Q format; 0 for an empty window)
+    value_type sum() const { return value_type(sat_cast<Storage>(sum_.v)); }
+
+    value_type mean() const {
+        if (count_ == 0) return value_type();
+        return value_type(sat_cast<Storage>(sum_.div_round(count_)));
+    }
+
+    // Sum of squares
+    value_type power() const { return value_type(sat_cast<Storage>(sum_sq_.round_shift(F))); }
+
+    value_type mean_square() const {
+        if (count_ == 0) return value_type();
+        return value_type(sat_cast<Storage>(round_shift(sum_sq_.div_round(count_), F)));
+    }
+
+    value_type rms() const {
+        if (count_ == 0) return value_type();
+        return value_type(detail::isqrt_fixed<Storage>(sum_sq_.div_round(count_), 2 * F, F));
+    }
+
+    value_type variance() const {
+        if (count_ == 0) return value_type();
+        return value_type(sat_cast<Storage>(round_shift(variance_q2f(), F)));
+    }
+
+    value_type stddev() const {
+        if (count_ == 0) return value_type();
+        return value_type(detail::isqrt_fixed<Storage>(variance_q2f(), 2 * F, F));
+    }
+
+    value_type min() const {
+        static_assert(TrackMinMax, "min() needs SlidingWindowStats<..., TrackMinMax = true>");
+        return count_ ? value_type(window_[min_q_.front_slot()]) : value_type();
+    }
+
+    value_type max() const {
+        static_assert(TrackMinMax, "max() needs SlidingWindowStats<..., TrackMinMax = true>");
+        return count_ ? value_type(window_[max_q_.front_slot()]) : value_type();
+    }
+
+private:
+    using SquareAcc = detail::ReduceProductAcc<I + F>;
+
+    // Monotonic deque of sample sequence numbers: the front is the extreme of
+    // the window, entries behind it are candidates once it expires
+    struct ExtremeQueue {
+        uint64_t seq[TrackMinMax ? N : 1];
+        size_t head = 0, count = 0;
+
+        void clear() { head = count = 0; }
+        size_t front_slot() const { return static_cast<size_t>(seq[head] % N); }
+
+        template<typename Keep>
+        void push(uint64_t s, const Storage* window, Keep keep) {
+            // Drop the sample that just left the window
+            if (count && seq[head] + N <= s) {
+                head = (head + 1) % N;
+                --count;
+            }
+            // Drop samples the new one dominates (keep(a, b): a stays ahead of b)
+            Storage x = window[static_cast<size_t>(s % N)];
+            while (count) {
+                size_t back = (head + count - 1) % N;
+                if (keep(window[static_cast<size_t>(seq[back] % N)], x)) break;
+                --count;
+            }
+            seq[(head + count) % N] = s;
+            ++count;
+        }
+    };
+
+    int64_t variance_q2f() const { return detail::stats_variance_q2f(sum_, sum_sq_, count_); }
+
+    Storage window_[N];
+    size_t count_ = 0;
+    uint64_t seq_ = 0;
+    detail::ReduceAcc64 sum_;
+    SquareAcc sum_sq_;
+    ExtremeQueue min_q_, max_q_;
+};
+
+// ============================================================================
+// RingBuffer: delay line exposing the last N samples as one contiguous view
+// ============================================================================
+//
+// Every sample is written twice, at slot p and p + N of a 2N buffer, and the
+// write position p walks downwards, so the last N samples are always
+// data[p .. p + N). A push is two stores instead of rolling the whole line
+// with memmove, and FIR / dot kernels run directly on view():
+//
+//   fp::RingBuffer<0, 31, 64> x;                  // 64 zeros
+//   x.push(sample);
+//   auto y = x.view().dot_product(h);             // sum h[k] * x[n - k]
+//
+// Element k of the view is the sample pushed k pushes ago (delay-line order,
+// newest first). The view is for reading: a write through it lands in one
+// copy only and is lost when the position wraps.
+
+template<int I, int F, size_t N, typename Backend = ReferenceBackend>
+class RingBuffer {
+    static_assert(N > 0, "delay line length must be positive");
+
+public:
+    using value_type = FixedPoint<I, F, Backend>;
+    using Storage = Storage_t<I + F>;
+    using View = FixedPointArray<I, F, Backend>;
+    static constexpr size_t capacity = N;
+
+    RingBuffer() { reset(); }
+
+    // Full line of copies of value
+    void reset(value_type value = value_type()) {
+        std::fill(buffer_, buffer_ + 2 * N, value.raw());
+        head_ = 0;
+    }
+
+    // New sample at view()[0]; the oldest one drops off the end
+    void push(value_type value) { push_raw(value.raw()); }
+
+    void push_raw(Storage x) {
+        head_ = (head_ == 0 ? N : head_) - 1;
+        buffer_[head_] = x;
+        buffer_[head_ + N] = x;
+    }
+
+    // Block of samples in time order (oldest first); only the last N of a
+    // longer block stay in the line
+    void push_block(const Storage* data, size_t length) {
+        if (length > N) {
+            data += length - N;
+            length = N;
+        }
+        for (size_t i = 0; i < length; ++i) push_raw(data[i]);
+    }
+
+    template<int XI, int XF>
+    void push_block(const FixedPointArray<XI, XF, Backend>& block) {
+        static_assert(XI == I && XF == F, "block must be in the delay line Q format");
+        push_block(block.data(), block.length());
+    }
+
+    // Sample pushed k pushes ago, k < N
+    value_type operator[](size_t k) const { return value_type(buffer_[head_ + k]); }
+    value_type front() const { return value_type(buffer_[head_]); }
+    value_type back() const { return value_type(buffer_[head_ + N - 1]); }
+
+    size_t size() const { return N; }
+
+    // The last N samples, newest first (read-only, see above: the view is
+    // const, so only its const operations apply)
+    const Storage* data() const { return buffer_ + head_; }
+    const View view() const { return View(const_cast<Storage*>(buffer_ + head_), N); }
+
+private:
+    Storage buffer_[2 * N];
+    size_t head_ = 0;
+};
+
+// ============================================================================
+// AlignedArray: array view with a compile-time layout guarantee
+// ============================================================================
+//
+// A FixedPointArray whose type also records that data() is aligned to Align
+// bytes and length() is a multiple of Mult elements. The guarantee is checked
+// once, when the view is made; from then on kernel selection is static:
+// operations between AlignedArrays pass Layout<Align, Mult> to the backend,
+// which picks the Xtensa *_fast variants at compile time (Align % 8 == 0,
+// Mult % 4 == 0) and hands host loops alignment hints and whole blocks, with
+// no per-call pointer checks and no remainder loops.
+//
+//   alignas(8) int16_t buf[64];
+//   auto x = fp::AlignedArray<1, 15, 8, 4>::from(buf);    // N % 4 checked at compile time
+//   auto y = fp::AlignedArray<1, 15, 8, 4>::from(p, n);   // std::nullopt if p or n does not fit
+//   auto z = vec.aligned();                               // FixedVector: always fits
+//
+// A view converts implicitly to a weaker guarantee (Align and Mult dividing
+// its own); the reverse does not compile. An operation on views with
+// different alignments uses the smallest one. Arguments that are plain
+// FixedPointArrays take the ordinary runtime-checked path.
+
+template<int I, int F, size_t Align, size_t Mult, typename Backend = ReferenceBackend>
+class AlignedArray : public FixedPointArray<I, F, Backend> {
+    using View = FixedPointArray<I, F, Backend>;
+
+public:
+    using Storage = Storage_t<I + F>;
+    using layout = Layout<Align, Mult>;
+    static constexpr int total_bits = I + F;
+
+    static_assert(Align > 0 && (Align & (Align - 1)) == 0, "Align must be a power of two");
+    static_assert(Align % alignof(Storage) == 0, "Align must be a multiple of the storage alignment");
+    static_assert(Mult > 0, "Mult must be positive");
+
+    // Checked factories
+    static std::optional<AlignedArray> from(Storage* data, size_t length) {
+        if ((reinterpret_cast<uintptr_t>(data) & (Align - 1)) != 0 || length % Mult != 0) {
+            return std::nullopt;
+        }
+        return AlignedArray(data, length);
+    }
+
+    template<size_t N>
+    static std::optional<AlignedArray> from(Storage (&data)[N]) {
+        static_assert(N % Mult == 0, "array length is not a multiple of Mult");
+        return from(data, N);
+    }
+
+    // Weaken the guarantee
+    template<size_t A2, size_t M2, std::enable_if_t<(A2 % Align == 0) && (M2 % Mult == 0), int> = 0>
+    AlignedArray(const AlignedArray<I, F, A2, M2, Backend>& other) : View(other) {}
+
+    // Layout-aware operations; the FixedPointArray overloads stay available
+    using View::elemult;
+    using View::add;
+    using View::sub;
+    using View::dot_product;
+    using View::scale;
+
+    template<size_t A2, size_t M2, size_t A3, size_t M3>
+    void elemult(const AlignedArray<I, F, A2, M2, Backend>& other,
+                 AlignedArray<I, F, A3, M3, Backend>& output) const {
+        Backend::template array_elemult<total_bits>(this->data(), other.data(), output.data(),
+                                                    this->length(), F, common<A2, A3>());
+    }
+
+    template<size_t A2, size_t M2, size_t A3, size_t M3>
+    void add(const AlignedArray<I, F, A2, M2, Backend>& other,
+             AlignedArray<I, F, A3, M3, Backend>& output) const {
+        Backend::template array_add<total_bits>(this->data(), other.data(), output.data(),
+                                                this->length(), common<A2, A3>());
+    }
+
+    template<size_t A2, size_t M2, size_t A3, size_t M3>
+    void sub(const AlignedArray<I, F, A2, M2, Backend>& other,
+             AlignedArray<I, F, A3, M3, Backend>& output) const {
+        Backend::template array_sub<total_bits>(this->data(), other.data(), output.data(),
+                                                this->length(), common<A2, A3>());
+    }
+
+    template<size_t A2, size_t M2>
+    FixedPoint<I, F, Backend> dot_product(const AlignedArray<I, F, A2, M2, Backend>& other) const {
+        auto result = Backend::template dot_product<total_bits>(this->data(), other.data(),
+                                                                this->length(), F, common<A2>());
+        return FixedPoint<I, F, Backend>(result);
+    }
+
+    void shift(int shift_amount) {
+        Backend::template array_shift<total_bits>(this->data(), this->length(), shift_amount, layout{});
+    }
+
+    void scale(FixedPoint<I, F, Backend> scale_factor) {
+        Backend::template array_scale<total_bits>(this->data(), this->length(), scale_factor.raw(), F,
+                                                  layout{});
+    }
+
+private:
+    // Owning storage that guarantees the layout by construction makes its
+    // views without the runtime check
+    template<int, int, typename, typename> friend class FixedVector;
+    template<int, int, size_t, typename> friend class FixedArray;
+
+    AlignedArray(Storage* data, size_t length) : View(data, length) {}
+
+    static AlignedArray unchecked(Storage* data, size_t length) { return AlignedArray(data, length); }
+
+    // Operands share this view's length, so Mult carries over; the alignment
+    // is the smallest of the operands'
+    template<size_t... As>
+    static constexpr auto common() {
+        constexpr size_t a = std::min({Align, As...});
+        return Layout<a, Mult>{};
+    }
+};
+
+// ============================================================================
+// FixedVector: owning, aligned array storage
+// ============================================================================
+//
+// FixedPointArray views caller-provided integers whose alignment is whatever
+// the caller happened to get, so the Xtensa *_fast kernels (8-byte aligned,
+// length a multiple of 4) are often rejected. FixedVector owns its storage:
+// the buffer starts on a 64-byte boundary (a cache line, and a multiple of
+// every SIMD width we target) and is padded to whole 64-byte blocks. It is a
+// FixedPointArray, so every array operation applies to it directly, and
+// padded() / aligned() give views of the whole blocks with no scalar tail:
+//
+//   fp::FixedVector<1, 15> x(160), y(160);
+//   x.add(y, x);                 // a FixedVector is a FixedPointArray
+//   x.aligned().shift(-1);       // whole blocks, *_fast chosen at compile time
+//
+// Padding is zero after construction and resize(), so reductions over
+// padded() see zeros; element-wise ops through padded() may write it, and
+// clear_padding() restores the zeros.
+//
+// Storage comes from Alloc: value_type is the storage integer and allocate(n)
+// returns memory aligned to 64 bytes, or nullptr when out of memory (the
+// vector is then left empty). AlignedAllocator is the heap default;
+// ArenaAllocator carves vectors out of a caller-owned Arena, e.g. a static
+// per-channel buffer on targets without a heap.
+
+inline constexpr size_t VECTOR_ALIGNMENT = 64;
+
+// Heap allocator returning Align-byte aligned blocks
+template<typename T, size_t Align = VECTOR_ALIGNMENT>
+struct AlignedAllocator {
+    using value_type = T;
+
+    AlignedAllocator() = default;
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align), std::nothrow));
+    }
+    void deallocate(T* p, size_t) { ::operator delete(p, std::align_val_t(Align)); }
+
+    bool operator==(const AlignedAllocator&) const { return true; }
+    bool operator!=(const AlignedAllocator&) const { return false; }
+};
+
+// Bump allocator over a caller-owned buffer; individual blocks are never
+// freed, reset() releases everything at once
+class Arena {
+public:
+    Arena(void* buffer, size_t bytes)
+        : base_(static_cast<unsigned char*>(buffer)), size_(bytes) {}
+
+    void* allocate(size_t bytes, size_t align) {
+        uintptr_t start = reinterpret_cast<uintptr_t>(base_);
+        uintptr_t p = (start + used_ + align - 1) & ~static_cast<uintptr_t>(align - 1);
+        size_t offset = static_cast<size_t>(p - start);
+        if (offset > size_ || bytes > size_ - offset) return nullptr;
+        used_ = offset + bytes;
+        return base_ + offset;
+    }
+
+    void reset() { used_ = 0; }
+    size_t used() const { return used_; }
+    size_t capacity() const { return size_; }
+
+private:
+    unsigned char* base_;
+    size_t size_;
+    size_t used_ = 0;
+};
+
+// Allocator adaptor handing out VECTOR_ALIGNMENT-aligned blocks from an Arena
+template<typename T>
+struct ArenaAllocator {
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) : arena(&arena) {}
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(arena->allocate(n * sizeof(T), VECTOR_ALIGNMENT)); }
+    void deallocate(T*, size_t) {}
+
+    bool operator==(const ArenaAllocator& rhs) const { return arena == rhs.arena; }
+    bool operator!=(const ArenaAllocator& rhs) const { return arena != rhs.arena; }
+
+    Arena* arena;
+};
+
+template<int I, int F, typename Backend = ReferenceBackend,
+         typename Alloc = AlignedAllocator<Storage_t<I + F>>>
+class FixedVector : public FixedPointArray<I, F, Backend> {
+    using View = FixedPointArray<I, F, Backend>;
+
+public:
+    using Storage = Storage_t<I + F>;
+    using allocator_type = Alloc;
+    static_assert(std::is_same_v<typename Alloc::value_type, Storage>,
+                  "allocator value_type must be the storage integer");
+
+    // Elements per 64-byte block; padded_length() is a multiple of this
+    static constexpr size_t block = VECTOR_ALIGNMENT / sizeof(Storage);
+
+    explicit FixedVector(const Alloc& alloc = Alloc())
+        : View(nullptr, 0), alloc_(alloc) {}
+
+    // length zeros
+    explicit FixedVector(size_t length, const Alloc& alloc = Alloc())
+        : FixedVector(alloc) { resize(length); }
+
+    FixedVector(size_t length, FixedPoint<I, F, Backend> value, const Alloc& alloc = Alloc())
+        : FixedVector(length, alloc) { fill(value); }
+
+    FixedVector(const FixedVector& other)
+        : FixedVector(other.alloc_) {
+        Storage* p = allocate_padded(other.padded_);
+        if (p) {
+            std::copy_n(other.data(), other.padded_, p);
+            attach(p, other.length(), other.padded_);
+        }
+    }
+
+    FixedVector(FixedVector&& other) noexcept
+        : View(other), alloc_(other.alloc_), padded_(other.padded_) {
+        other.attach(nullptr, 0, 0);
+    }
+
+    FixedVector& operator=(FixedVector other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~FixedVector() { release(); }
+
+    void swap(FixedVector& other) noexcept {
+        View tmp = *this;
+        View::operator=(other);
+        static_cast<View&>(other) = tmp;
+        std::swap(alloc_, other.alloc_);
+        std::swap(padded_, other.padded_);
+    }
+
+    // Change the length, keeping the first min(old, new) elements; new
+    // elements and the padding are zero. Reallocates only when the padded
+    // length changes.
+    void resize(size_t length) {
+        size_t keep = std::min(this->length(), length);
+        size_t padded = (length + block - 1) / block * block;
+        if (padded != padded_) {
+            Storage* p = allocate_padded(padded);
+            if (!p && padded) {
+                release();
+                return;
+            }
+            std::copy_n(this->data(), keep, p);
+            release();
+            attach(p, length, padded);
+        }
+        std::fill(this->data() + keep, this->data() + padded_, Storage(0));
+        attach(this->data(), length, padded_);
+    }
+
+    void fill(FixedPoint<I, F, Backend> value) {
+        std::fill_n(this->data(), this->length(), value.raw());
+    }
+
+    void clear_padding() {
+        std::fill(this->data() + this->length(), this->data() + padded_, Storage(0));
+    }
+
+    // Length rounded up to whole 64-byte blocks
+    size_t padded_length() const { return padded_; }
+
+    // View of the whole blocks, padding included
+    View padded() { return View(this->data(), padded_); }
+
+    // The same, as an AlignedArray: operations on it select the aligned,
+    // whole-block kernels at compile time
+    AlignedArray<I, F, VECTOR_ALIGNMENT, block, Backend> aligned() {
+        return AlignedArray<I, F, VECTOR_ALIGNMENT, block, Backend>::unchecked(this->data(), padded_);
+    }
+
+    const Alloc& get_allocator() const { return alloc_; }
+
+private:
+    Storage* allocate_padded(size_t padded) {
+        return padded ? alloc_.allocate(padded) : nullptr;
+    }
+
+    void attach(Storage* p, size_t length, size_t padded) {
+        View::operator=(View(p, length));
+        padded_ = padded;
+    }
+
+    void release() {
+        if (this->data()) alloc_.deallocate(this->data(), padded_);
+        attach(nullptr, 0, 0);
+    }
+
+    Alloc alloc_;
+    size_t padded_ = 0;
+};
+
+namespace detail {
+
+// A FixedVector is an array operand of lazy expressions, like its view
+template<int I, int F, typename Backend, typename Alloc>
+struct ExprOperand<FixedVector<I, F, Backend, Alloc>> : ExprOperand<FixedPointArray<I, F, Backend>> {};
+
+} // namespace detail
+
+// ============================================================================
+// FixedArray: owning array with a compile-time length
+// ============================================================================
+//
+// Filters and windows whose length is fixed at compile time (64 or 128 AFC
+// taps) keep their data in a FixedArray: std::array storage, no allocation,
+// and the operations run the backend's static_* kernels, which take N as a
+// template argument: the reference loops are expanded in blocks with no
+// remainder path and no length checks, and Xtensa picks the *_fast
+// variants at compile time when N % 4 == 0.
+//
+//   fp::FixedArray<1, 15, 64> taps, state, tmp;
+//   state.elemult(taps, tmp);
+//   auto y = state.dot_product(taps);
+//   x.view().stats();                 // any FixedPointArray operation
+//
+// view() and aligned() give non-owning views of the storage, so FixedArrays
+// mix freely with FixedPointArray / AlignedArray code; a FixedArray also
+// converts implicitly to a read-only FixedPointArray argument.
+
+template<int I, int F, size_t N, typename Backend = ReferenceBackend>
+class FixedArray {
+    static_assert(N > 0, "FixedArray length must be positive");
+
+public:
+    using value_type = FixedPoint<I, F, Backend>;
+    using Storage = Storage_t<I + F>;
+    using View = FixedPointArray<I, F, Backend>;
+    static constexpr int total_bits = I + F;
+    static constexpr size_t extent = N;
+
+    // Whole cache lines for arrays of a line or more, 8 bytes (Xtensa *_fast)
+    // for shorter ones
+    static constexpr size_t alignment =
+        (N * sizeof(Storage) >= VECTOR_ALIGNMENT) ? VECTOR_ALIGNMENT : std::max<size_t>(8, alignof(Storage));
+    using Aligned = AlignedArray<I, F, alignment, N, Backend>;
+
+    // Zeros
+    FixedArray() { data_.fill(Storage(0)); }
+
+    explicit FixedArray(value_type value) { fill(value); }
+
+    explicit FixedArray(const std::array<Storage, N>& raw) : data_(raw) {}
+
+    void fill(value_type value) { data_.fill(value.raw()); }
+
+    value_type operator[](size_t i) const { return value_type(data_[i]); }
+    void set(size_t i, value_type value) { data_[i] = value.raw(); }
+
+    Storage* data() { return data_.data(); }
+    const Storage* data() const { return data_.data(); }
+    std::array<Storage, N>& raw() { return data_; }
+    const std::array<Storage, N>& raw() const { return data_; }
+    static constexpr size_t size() { return N; }
+
+    // Views of the storage; a const FixedArray gives const views, which only
+    // have the read-only operations
+    View view() { return View(data_.data(), N); }
+    const View view() const { return View(const_cast<Storage*>(data_.data()), N); }
+    Aligned aligned() { return Aligned::unchecked(data_.data(), N); }
+    const Aligned aligned() const { return Aligned::unchecked(const_cast<Storage*>(data_.data()), N); }
+
+    operator const View() const { return view(); }
+
+    void from_floats(const float* input) { view().from_floats(input, N); }
+    void to_floats(float* output) const { view().to_floats(output); }
+
+    // Element-wise operations (out-of-place; output may be this or other)
+    void elemult(const FixedArray& other, FixedArray& output) const {
+        Backend::template static_elemult<total_bits, N>(data(), other.data(), output.data(), F);
+    }
+
+    void add(const FixedArray& other, FixedArray& output) const {
+        Backend::template static_add<total_bits, N>(data(), other.data(), output.data());
+    }
+
+    void sub(const FixedArray& other, FixedArray& output) const {
+        Backend::template static_sub<total_bits, N>(data(), other.data(), output.data());
+    }
+
+    value_type dot_product(const FixedArray& other) const {
+        return value_type(Backend::template static_dot_product<total_bits, N>(data(), other.data(), F));
+    }
+
+    // In-place operations
+    void shift(int shift_amount) {
+        Backend::template static_shift<total_bits, N>(data(), shift_amount);
+    }
+
+    void scale(value_type scale_factor) {
+        Backend::template static_scale<total_bits, N>(data(), scale_factor.raw(), F);
+    }
+
+    // Fused evaluation of a lazy array expression (see FixedPointArray::assign)
+    template<typename E>
+    void assign(const ArrayExpr<E>& expr) { view().assign(expr); }
+
+private:
+    alignas(alignment) std::array<Storage, N> data_;
+};
+
+// ---------- Free helpers (no ambiguous operator overloads) ----------
+
+// Explicit result format helper: fp::mul_as<OUT_I,OUT_F>(a,b)
+template<int OUT_I, int OUT_F, typename QA, typename QB>
+auto mul_as(const QA& a, const QB& b) {
+    return a.template mul<OUT_I, OUT_F>(b);
+}
+
+// Explicit result format helper: fp::div_as<OUT_I,OUT_F>(a,b)
+template<int OUT_I, int OUT_F, typename QA, typename QB>
+auto div_as(const QA& a, const QB& b) {
+    return a.template div<OUT_I, OUT_F>(b);
+}
+
+// Square root of a 64-bit accumulator with ACC_F fractional bits, returned as
+// Q<OUT_I,OUT_F> (like NatureDSP scl_sqrt64x32): fp::sqrt64<1,15>(acc, 30)
+template<int OUT_I, int OUT_F, typename Backend = ReferenceBackend>
+FixedPoint<OUT_I, OUT_F, Backend> sqrt64(int64_t acc, int acc_frac_bits) {
+    auto result = Backend::template sqrt64<OUT_I + OUT_F>(acc, acc_frac_bits, OUT_F);
+    return FixedPoint<OUT_I, OUT_F, Backend>(result);
 }
 
 // If you *later* want a promoting operator*, define it here,
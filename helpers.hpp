@@ -2,6 +2,7 @@
 #include <type_traits>
 #include <limits>
 #include <cstdint>
+#include <cstddef>
 
 namespace fp {
 
@@ -40,15 +41,79 @@ constexpr To sat_cast(From v) {
     return static_cast<To>(w);
 }
 
+// Accuracy tiers for transcendental functions: x.sin<fp::fast>()
+// Each tier selects polynomial degree / Newton iteration count in the integer
+// kernels (see backends/reference/poly_approx.hpp for the error bounds)
+struct fast     {};
+struct balanced {};
+struct precise  {};
+
+// Field selection for FixedPointArray::stats<Mask>(): x.stats<stat::mean | stat::rms>()
+// Only the accumulators needed by the selected fields run in the fused pass
+namespace stat {
+enum : unsigned {
+    min      = 1u << 0,
+    max      = 1u << 1,
+    sum      = 1u << 2,
+    mean     = 1u << 3,
+    power    = 1u << 4,
+    rms      = 1u << 5,
+    variance = 1u << 6,
+    stddev   = 1u << 7,
+    all      = 0xFFu
+};
+} // namespace stat
+
+// Memory layout carried in an array view type (AlignedArray): data aligned to
+// Align bytes, length a multiple of Mult elements. Backends take it as a tag,
+// so kernel variants that need the layout are selected at compile time.
+template<size_t Align, size_t Mult>
+struct Layout {
+    static constexpr size_t alignment = Align;
+    static constexpr size_t multiple = Mult;
+
+    // The length as the optimizer may assume it: whole Mult-element blocks
+    static constexpr size_t blocks(size_t length) { return length / Mult * Mult; }
+};
+
+using AnyLayout = Layout<1, 1>;
+
+// Alignment hint for the optimizer; the caller guarantees it
+template<size_t Align, typename T>
+inline T* assume_aligned(T* p) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<T*>(__builtin_assume_aligned(p, Align));
+#else
+    return p;
+#endif
+}
+
 // Priority tag ladder
 template<int N> struct priority_tag : priority_tag<N-1> {};
 template<> struct priority_tag<0> {};
 
-// signed round-to-nearest, ties away from zero (simple variant)
+// signed round-to-nearest, ties away from zero, symmetric about zero:
+// round_shift(x, s) == -round_shift(-x, s). Exact negative multiples of 2^s
+// divide exactly (round_shift(-2, 1) == -1) and negative ties move away from
+// zero (round_shift(-3, 1) == -2); a plain (x - bias) >> s would push the
+// exact multiples one step down. Negative x uses floor((x + bias - 1) / 2^s),
+// which equals -round(-x / 2^s) without negating x (LLONG_MIN has no negation)
 inline auto round_shift = [](long long x, int s) -> long long {
     if (s <= 0) return (s==0 ? x : (x << (-s)));
     long long bias = 1ll << (s - 1);
-    return (x >= 0) ? (x + bias) >> s : (x - bias) >> s;
+    return (x >= 0) ? (x + bias) >> s : (x + (bias - 1)) >> s;
 };
 
+// Count leading zeros of a 64-bit value (returns 64 for zero)
+inline int count_leading_zeros64(uint64_t x) {
+    if (x == 0) return 64;
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#else
+    int n = 0;
+    while ((x & (1ull << 63)) == 0) { x <<= 1; ++n; }
+    return n;
+#endif
+}
+
 } // namespace fp
@@ -0,0 +1,285 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Worker threads are opt-in: define FP_ENABLE_THREADS (and link the
+// platform thread library) to get them on host. Without it, and always on
+// target, the same API runs everything on the calling thread
+#if defined(FP_ENABLE_THREADS) && !defined(__XTENSA__)
+#define FP_HAS_THREADS 1
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#else
+#define FP_HAS_THREADS 0
+#endif
+
+namespace fp {
+
+// ============================================================================
+// Execution policies and the work-stealing thread pool
+// ============================================================================
+//
+// Large FixedPointArray ops (offline analysis, batch processing of recorded
+// data) take an execution policy as their last argument:
+//   auto e = x.dot_product(y, fp::par);         // default pool
+//   auto s = x.stats(fp::parallel_policy{&pool});
+// The array is cut into fixed, cache-sized chunks (chunk_bytes per operand)
+// whose boundaries depend only on the length, never on the thread count.
+// Element-wise ops run the serial kernel per chunk; reductions keep the exact
+// integer accumulator of every chunk and merge them in chunk order, so the
+// result is bit-identical to the serial call on any number of threads.
+
+class ThreadPool;
+
+struct sequenced_policy {};
+
+struct parallel_policy {
+    ThreadPool* pool = nullptr;         // nullptr: default_thread_pool()
+    size_t chunk_bytes = 64 * 1024;     // per operand; L2-sized working set
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+template<typename T> struct is_execution_policy : std::false_type {};
+template<> struct is_execution_policy<sequenced_policy> : std::true_type {};
+template<> struct is_execution_policy<parallel_policy> : std::true_type {};
+
+// Fixed pool of workers; parallel_for(count, fn) runs fn(i) for every i in
+// [0, count) and returns when all have finished. The indices are dealt out
+// as one contiguous range per participant (the caller takes part); a
+// participant works through its own range from the front and, once it runs
+// dry, steals from the back of the others. Jobs from different threads are
+// serialized; fn must not call parallel_for on the same pool.
+class ThreadPool {
+public:
+    // threads: total participants including the caller (0: one per core)
+    explicit ThreadPool(unsigned threads = 0)
+    {
+#if FP_HAS_THREADS
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+        for (unsigned t = 1; t < threads; ++t) {
+            workers_.emplace_back([this, t] { worker_loop(t); });
+        }
+#else
+        (void)threads;
+#endif
+    }
+
+    ~ThreadPool()
+    {
+#if FP_HAS_THREADS
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& w : workers_) w.join();
+#endif
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Participants in a job, the calling thread included
+    unsigned size() const
+    {
+#if FP_HAS_THREADS
+        return static_cast<unsigned>(workers_.size()) + 1;
+#else
+        return 1;
+#endif
+    }
+
+    template<typename Fn>
+    void parallel_for(size_t count, Fn&& fn)
+    {
+#if FP_HAS_THREADS
+        if (count == 0) return;
+        if (workers_.empty() || count == 1) {
+            for (size_t i = 0; i < count; ++i) fn(i);
+            return;
+        }
+
+        std::lock_guard<std::mutex> serialize(submit_);
+        const unsigned n = size();
+        Job job;
+        job.ranges.reset(new Range[n]);
+        for (unsigned p = 0; p < n; ++p) {
+            job.ranges[p].begin = count * p / n;
+            job.ranges[p].end = count * (p + 1) / n;
+        }
+        job.participants = n;
+        job.context = &fn;
+        job.call = [](void* ctx, size_t i) { (*static_cast<std::remove_reference_t<Fn>*>(ctx))(i); };
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            ++generation_;
+            active_ = static_cast<unsigned>(workers_.size());
+        }
+        wake_.notify_all();
+
+        while (run_one(job, 0)) {}
+
+        // The job lives on this stack frame: wait until every worker has left it
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+        job_ = nullptr;
+#else
+        for (size_t i = 0; i < count; ++i) fn(i);
+#endif
+    }
+
+private:
+#if FP_HAS_THREADS
+    struct Range {
+        std::mutex mutex;
+        size_t begin = 0, end = 0;
+    };
+
+    struct Job {
+        std::unique_ptr<Range[]> ranges;
+        unsigned participants = 0;
+        void* context = nullptr;
+        void (*call)(void*, size_t) = nullptr;
+    };
+
+    // Run one index: own range first, then steal; false when nothing is left
+    static bool run_one(Job& job, unsigned self)
+    {
+        size_t index = 0;
+        bool found = false;
+        {
+            Range& own = job.ranges[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (own.begin < own.end) {
+                index = own.begin++;
+                found = true;
+            }
+        }
+        for (unsigned k = 1; !found && k < job.participants; ++k) {
+            Range& victim = job.ranges[(self + k) % job.participants];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.begin < victim.end) {
+                index = --victim.end;
+                found = true;
+            }
+        }
+        if (found) job.call(job.context, index);
+        return found;
+    }
+
+    void worker_loop(unsigned self)
+    {
+        uint64_t seen = 0;
+        for (;;) {
+            Job* job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+                job = job_;
+            }
+
+            while (run_one(*job, self)) {}
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) done_.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex submit_;
+    std::mutex mutex_;
+    std::condition_variable wake_, done_;
+    Job* job_ = nullptr;
+    uint64_t generation_ = 0;
+    unsigned active_ = 0;
+    bool stop_ = false;
+#endif
+};
+
+// Process-wide pool used by fp::par, one participant per core; created on
+// first use
+inline ThreadPool& default_thread_pool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+namespace detail {
+
+// Minimum chunk, in elements: below this, scheduling costs more than it saves
+inline constexpr size_t PAR_MIN_CHUNK = 4096;
+
+// Fixed chunking of [0, length): chunk i covers [i * size, min((i+1) * size, length))
+struct ChunkPlan {
+    size_t size;
+    size_t count;
+
+    size_t begin(size_t i) const { return i * size; }
+    size_t length(size_t i, size_t total) const {
+        size_t b = i * size;
+        return (total - b < size) ? total - b : size;
+    }
+};
+
+inline ChunkPlan plan_chunks(const parallel_policy& policy, size_t length, size_t elem_bytes)
+{
+    size_t size = policy.chunk_bytes / elem_bytes;
+    if (size < PAR_MIN_CHUNK) size = PAR_MIN_CHUNK;
+    size = (size + 63) / 64 * 64;       // whole cache lines / vector blocks
+    return ChunkPlan{size, (length + size - 1) / size};
+}
+
+inline ThreadPool& policy_pool(const parallel_policy& policy)
+{
+    return policy.pool ? *policy.pool : default_thread_pool();
+}
+
+// Run fn(begin, length) over the chunks of [0, length); false (nothing run)
+// when a single participant or a single chunk would do the work, so the
+// caller takes its plain serial path
+template<typename Fn>
+inline bool parallel_chunks(const parallel_policy& policy, size_t length, size_t elem_bytes, Fn&& fn)
+{
+    if (!FP_HAS_THREADS) return false;
+    ChunkPlan plan = plan_chunks(policy, length, elem_bytes);
+    ThreadPool& pool = policy_pool(policy);
+    if (plan.count < 2 || pool.size() < 2) return false;
+
+    pool.parallel_for(plan.count, [&](size_t i) { fn(plan.begin(i), plan.length(i, length)); });
+    return true;
+}
+
+// Reduction over the chunks: partial(begin, length) returns the exact
+// accumulator of one chunk; the partials are merged in chunk order into acc.
+// False (acc untouched) when parallel_chunks would not split the work
+template<typename Acc, typename Partial>
+inline bool parallel_reduce(const parallel_policy& policy, size_t length, size_t elem_bytes,
+                            Acc& acc, Partial&& partial)
+{
+    if (!FP_HAS_THREADS) return false;
+    ChunkPlan plan = plan_chunks(policy, length, elem_bytes);
+    ThreadPool& pool = policy_pool(policy);
+    if (plan.count < 2 || pool.size() < 2) return false;
+
+    std::vector<Acc> parts(plan.count);
+    pool.parallel_for(plan.count, [&](size_t i) { parts[i] = partial(plan.begin(i), plan.length(i, length)); });
+    for (const Acc& p : parts) {
+        acc.merge(p);
+        acc.normalize();
+    }
+    return true;
+}
+
+} // namespace detail
+} // namespace fp
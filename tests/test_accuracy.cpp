@@ -0,0 +1,207 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+namespace fp {
+namespace test {
+
+// Sweep a unary function over [lo, hi] and check the worst-case absolute
+// error against libm (double). The tolerance is the documented error bound
+// of the tier (poly_approx.hpp) plus the output quantization.
+template<typename Acc, typename Q, typename Fn, typename Ref>
+void check_sweep(const char* name, double lo, double hi, Fn fn, Ref ref,
+                 double bound, double out_lsb, int steps = 4001)
+{
+    double max_err = 0.0;
+    for (int i = 0; i < steps; ++i) {
+        double x = lo + (hi - lo) * i / (steps - 1);
+        auto X = Q::from_float(static_cast<float>(x));
+        double xq = static_cast<double>(X.raw()) / std::ldexp(1.0, Q::frac_bits);
+
+        double got = fn(X);
+        double err = std::fabs(got - ref(xq));
+        if (err > max_err) max_err = err;
+    }
+    expect_near(name, static_cast<float>(max_err), 0.0f,
+                static_cast<float>(1.25 * bound + out_lsb));
+}
+
+// Same check for the array kernels, which take the backend's vector paths
+// (NatureDSP on Xtensa) rather than the scalar ones
+template<typename Acc, int I, int F, int OI, int OF, typename Op, typename Ref>
+void check_array_sweep(const char* name, double lo, double hi, Op op, Ref ref,
+                       double bound, double out_lsb, size_t steps = 1024)
+{
+    std::vector<int32_t> in(steps), out(steps);
+    for (size_t i = 0; i < steps; ++i) {
+        double x = lo + (hi - lo) * double(i) / double(steps - 1);
+        in[i] = q<I, F, fp::test::Backend>::from_float(static_cast<float>(x)).raw();
+    }
+    q_array<I, F, fp::test::Backend> X(in.data(), steps);
+    q_array<OI, OF, fp::test::Backend> Y(out.data(), steps);
+    op(X, Y);
+
+    double max_err = 0.0;
+    for (size_t i = 0; i < steps; ++i) {
+        double xq = std::ldexp(double(in[i]), -F);
+        double err = std::fabs(std::ldexp(double(out[i]), -OF) - ref(xq));
+        if (err > max_err) max_err = err;
+    }
+    expect_near(name, static_cast<float>(max_err), 0.0f,
+                static_cast<float>(1.25 * bound + out_lsb));
+}
+
+template<typename Acc>
+void run_tier(const char* tier, double log_err, double exp_err, double trig_err,
+              double atan_err, double sqrt_err, double tanh_err)
+{
+    using q29 = q<3, 29, fp::test::Backend>;    // tan / sqrt / pow arguments
+    using q27 = q<5, 27, fp::test::Backend>;    // wide-range trig / activation arguments
+    using q25 = q<7, 25, fp::test::Backend>;    // antilog arguments (Q6.25)
+    using q15 = q<17, 15, fp::test::Backend>;   // log arguments
+
+    const double lsb29 = std::ldexp(1.0, -29);
+    const double lsb27 = std::ldexp(1.0, -27);
+    const double lsb25 = std::ldexp(1.0, -25);
+    const double lsb15 = std::ldexp(1.0, -15);
+    char name[96];
+
+    // log2 / logn / log10: absolute error in the Q6.25 output
+    std::snprintf(name, sizeof(name), "%s log2 [1/64, 30000]", tier);
+    check_sweep<Acc, q15>(name, 1.0 / 64, 30000.0,
+        [](q15 x) { return double(x.template log2<Acc>().to_float()); },
+        [](double x) { return std::log2(x); }, log_err, lsb25 + 1e-6);
+
+    std::snprintf(name, sizeof(name), "%s logn [1/64, 30000]", tier);
+    check_sweep<Acc, q15>(name, 1.0 / 64, 30000.0,
+        [](q15 x) { return double(x.template logn<Acc>().to_float()); },
+        [](double x) { return std::log(x); }, log_err * std::log(2.0), lsb25 + 1e-6);
+
+    std::snprintf(name, sizeof(name), "%s log10 [1/64, 30000]", tier);
+    check_sweep<Acc, q15>(name, 1.0 / 64, 30000.0,
+        [](q15 x) { return double(x.template log10<Acc>().to_float()); },
+        [](double x) { return std::log10(x); }, log_err * std::log10(2.0), lsb25 + 1e-6);
+
+    // antilog2: relative error, checked on 2^x / 2^x where the Q16.15 output
+    // is at least 16 (quantization below 2^-20 relative)
+    std::snprintf(name, sizeof(name), "%s antilog2 rel [4, 14]", tier);
+    check_sweep<Acc, q25>(name, 4.0, 14.0,
+        [](q25 x) {
+            double xq = double(x.raw()) / (1 << 25);
+            return double(x.template antilog2<Acc>().raw()) / 32768.0 / std::exp2(xq);
+        },
+        [](double) { return 1.0; }, exp_err, lsb15 / 16.0);
+
+    std::snprintf(name, sizeof(name), "%s antilogn rel [3, 9]", tier);
+    check_sweep<Acc, q25>(name, 3.0, 9.0,
+        [](q25 x) {
+            double xq = double(x.raw()) / (1 << 25);
+            return double(x.template antilogn<Acc>().raw()) / 32768.0 / std::exp(xq);
+        },
+        [](double) { return 1.0; }, exp_err + 1e-7, lsb15 / 16.0);
+
+    // sin / cos / atan: absolute error in Q5.27
+    std::snprintf(name, sizeof(name), "%s sin [-15, 15]", tier);
+    check_sweep<Acc, q27>(name, -15.0, 15.0,
+        [](q27 x) { return double(x.template sin<Acc>().raw()) / (1 << 27); },
+        [](double x) { return std::sin(x); }, trig_err, lsb27);
+
+    std::snprintf(name, sizeof(name), "%s cos [-15, 15]", tier);
+    check_sweep<Acc, q27>(name, -15.0, 15.0,
+        [](q27 x) { return double(x.template cos<Acc>().raw()) / (1 << 27); },
+        [](double x) { return std::cos(x); }, trig_err, lsb27);
+
+    std::snprintf(name, sizeof(name), "%s tan [-1, 1]", tier);
+    check_sweep<Acc, q29>(name, -1.0, 1.0,
+        [](q29 x) { return double(x.template tan<Acc>().raw()) / (1 << 29); },
+        [](double x) { return std::tan(x); }, 2.0 * trig_err / std::cos(1.0), lsb29);
+
+    std::snprintf(name, sizeof(name), "%s atan [-15, 15]", tier);
+    check_sweep<Acc, q27>(name, -15.0, 15.0,
+        [](q27 x) { return double(x.template atan<Acc>().raw()) / (1 << 27); },
+        [](double x) { return std::atan(x); }, atan_err, lsb27);
+
+    // tanh / sigmoid: piecewise polynomial, sigmoid carries half the tanh error
+    std::snprintf(name, sizeof(name), "%s tanh [-15, 15]", tier);
+    check_sweep<Acc, q27>(name, -15.0, 15.0,
+        [](q27 x) { return double(x.template tanh<Acc>().raw()) / (1 << 27); },
+        [](double x) { return std::tanh(x); }, tanh_err, lsb27);
+
+    std::snprintf(name, sizeof(name), "%s sigmoid [-15, 15]", tier);
+    check_sweep<Acc, q27>(name, -15.0, 15.0,
+        [](q27 x) { return double(x.template sigmoid<Acc>().raw()) / (1 << 27); },
+        [](double x) { return 1.0 / (1.0 + std::exp(-x)); }, 0.5 * tanh_err, lsb27);
+
+    // sqrt / rsqrt: relative error bound scaled by the largest result
+    std::snprintf(name, sizeof(name), "%s sqrt [0.01, 3.9]", tier);
+    check_sweep<Acc, q29>(name, 0.01, 3.9,
+        [](q29 x) { return double(x.template sqrt<Acc>().raw()) / (1 << 29); },
+        [](double x) { return std::sqrt(x); }, 2.0 * sqrt_err, lsb29);
+
+    std::snprintf(name, sizeof(name), "%s rsqrt [0.25, 3.9]", tier);
+    check_sweep<Acc, q29>(name, 0.25, 3.9,
+        [](q29 x) { return double(x.template rsqrt<Acc>().raw()) / (1 << 29); },
+        [](double x) { return 1.0 / std::sqrt(x); }, 2.0 * sqrt_err, 2.0 * lsb29);
+
+    // pow: |y| * ln(2) * log2_err + exp2_err, relative (result below 4)
+    std::snprintf(name, sizeof(name), "%s pow(x, 1.5) rel [0.5, 2.4]", tier);
+    check_sweep<Acc, q29>(name, 0.5, 2.4,
+        [](q29 x) {
+            double xq = double(x.raw()) / (1 << 29);
+            auto y = q29::from_float(1.5f);
+            return double(x.template pow<Acc>(y).raw()) / (1 << 29) / std::pow(xq, 1.5);
+        },
+        [](double) { return 1.0; }, 1.5 * std::log(2.0) * log_err + exp_err, 2.0 * lsb29 / 0.35);
+
+    // Array kernels over the same ranges
+    std::snprintf(name, sizeof(name), "%s array log2 [1/64, 30000]", tier);
+    check_array_sweep<Acc, 17, 15, 6, 25>(name, 1.0 / 64, 30000.0,
+        [](const auto& x, auto& y) { x.template log2<Acc>(y); },
+        [](double x) { return std::log2(x); }, log_err, lsb25 + 1e-6);
+
+    std::snprintf(name, sizeof(name), "%s array sin [-15, 15]", tier);
+    check_array_sweep<Acc, 5, 27, 5, 27>(name, -15.0, 15.0,
+        [](const auto& x, auto& y) { x.template sin<Acc>(y); },
+        [](double x) { return std::sin(x); }, trig_err, lsb27);
+
+    std::snprintf(name, sizeof(name), "%s array cos [-15, 15]", tier);
+    check_array_sweep<Acc, 5, 27, 5, 27>(name, -15.0, 15.0,
+        [](const auto& x, auto& y) { x.template cos<Acc>(y); },
+        [](double x) { return std::cos(x); }, trig_err, lsb27);
+}
+
+void run_accuracy_tests() {
+    std::puts("\n--- Accuracy Tier Tests ---");
+
+    //                              log2     exp2     sin/cos  atan     sqrt     tanh
+    run_tier<fp::fast>    ("fast",     7.7e-4,  1.1e-4,  1.5e-4,  6.1e-4,  3.7e-4,  9.1e-5);
+    run_tier<fp::balanced>("balanced", 2.1e-6,  1.1e-7,  5.7e-7,  1.1e-7,  2.0e-7,  3.1e-8);
+    run_tier<fp::precise> ("precise",  4.3e-9,  2.1e-9,  1.6e-9,  1.9e-9,  1.9e-9,  3.2e-9);
+
+    // Each tier meets its own sin/cos bound (plus output rounding) on a known value
+    {
+        using q29 = q<3, 29, fp::test::Backend>;
+        auto x = q29::from_float(0.7f);
+        const double want = std::sin(double(x.raw()) / (1 << 29));
+        const double half_lsb = 0.5 / (1 << 29);
+        expect_near("sin(0.7) fast", float(double(x.sin<fp::fast>().raw()) / (1 << 29) - want), 0.0f,
+                    float(1.5e-4 + half_lsb));
+        expect_near("sin(0.7) balanced", float(double(x.sin<fp::balanced>().raw()) / (1 << 29) - want), 0.0f,
+                    float(5.7e-7 + half_lsb));
+        expect_near("sin(0.7) precise", float(double(x.sin<fp::precise>().raw()) / (1 << 29) - want), 0.0f,
+                    float(1.6e-9 + half_lsb));
+        expect_near("sin() defaults to precise", x.sin().to_float(), x.sin<fp::precise>().to_float(), 0.0f);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_accuracy_tests();
+    return 0;
+}
+#endif
@@ -0,0 +1,115 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+
+namespace fp {
+namespace test {
+
+void run_activation_tests() {
+    using q15  = q<16, 15, fp::test::Backend>;
+    using q16  = q<1, 15, fp::test::Backend>;
+    using q412 = q<4, 12, fp::test::Backend>;
+
+    std::puts("\n--- Activation (tanh / sigmoid) Tests ---");
+
+    const float lsb15 = 1.0f / static_cast<float>(1u << 15);
+    const float lsb12 = 1.0f / static_cast<float>(1u << 12);
+
+    // Known values, Q16.15
+    {
+        float xs[] = {0.0f, 0.25f, -0.8f, 1.5f, -3.0f, 6.0f};
+        for (float x : xs) {
+            auto X = q15::from_float(x);
+            char name[64];
+            std::snprintf(name, sizeof(name), "tanh(%g) Q16.15", x);
+            expect_near(name, X.tanh().to_float(), std::tanh(x), lsb15);
+            std::snprintf(name, sizeof(name), "sigmoid(%g) Q16.15", x);
+            expect_near(name, X.sigmoid().to_float(), 1.0f / (1.0f + std::exp(-x)), lsb15);
+        }
+    }
+
+    // Saturation regions: far beyond the last segment
+    {
+        expect_near("tanh(100) = 1", q15::from_float(100.0f).tanh().to_float(), 1.0f, 0.0f);
+        expect_near("tanh(-30000) = -1", q15::from_float(-30000.0f).tanh().to_float(), -1.0f, 0.0f);
+        expect_near("sigmoid(-100) = 0", q15::from_float(-100.0f).sigmoid().to_float(), 0.0f, 0.0f);
+        expect_near("sigmoid(100) = 1", q15::from_float(100.0f).sigmoid().to_float(), 1.0f, 0.0f);
+    }
+
+    // Symmetry: tanh is odd, sigmoid(-x) = 1 - sigmoid(x)
+    {
+        int32_t worst_tanh = 0, worst_sig = 0;
+        for (int32_t raw = 0; raw < (12 << 15); raw += 97) {
+            int32_t tp = q15(raw).tanh().raw(), tn = q15(-raw).tanh().raw();
+            int32_t sp = q15(raw).sigmoid().raw(), sn = q15(-raw).sigmoid().raw();
+            worst_tanh = std::max(worst_tanh, std::abs(tp + tn));
+            worst_sig  = std::max(worst_sig, std::abs(sp + sn - (1 << 15)));
+        }
+        expect_near("tanh odd symmetry (LSB)", float(worst_tanh), 0.0f, 0.0f);
+        expect_near("sigmoid symmetry (LSB)", float(worst_sig), 0.0f, 1.0f);
+    }
+
+    // 16-bit formats: Q1.15 saturates at the top of the range, Q4.12 full sweep
+    {
+        expect_near("tanh(0.99) Q1.15", q16::from_float(0.99f).tanh().to_float(), std::tanh(0.99f), lsb15);
+        expect_near("sigmoid(0.99) Q1.15", q16::from_float(0.99f).sigmoid().to_float(),
+                    1.0f / (1.0f + std::exp(-0.99f)), lsb15);
+
+        float worst = 0.0f;
+        for (int32_t raw = -32768; raw < 32768; raw += 13) {
+            auto X = q412(static_cast<int16_t>(raw));
+            float x = X.to_float();
+            worst = std::max(worst, std::fabs(X.tanh().to_float() - std::tanh(x)));
+        }
+        expect_near("tanh Q4.12 sweep max error", worst, 0.0f, lsb12);
+    }
+
+    // Array versions match the scalar kernels element for element
+    {
+        constexpr size_t N = 67;
+        int32_t in[N], out_t[N], out_s[N];
+        for (size_t i = 0; i < N; ++i) {
+            in[i] = q15::from_float(-9.0f + 18.0f * float(i) / float(N - 1)).raw();
+        }
+        q_array<16, 15, fp::test::Backend> x(in, N), yt(out_t, N), ys(out_s, N);
+        x.tanh(yt);
+        x.sigmoid(ys);
+
+        int mismatches = 0;
+        for (size_t i = 0; i < N; ++i) {
+            mismatches += (out_t[i] != q15(in[i]).tanh().raw());
+            mismatches += (out_s[i] != q15(in[i]).sigmoid().raw());
+        }
+        expect_near("array tanh/sigmoid == scalar (Q16.15)", float(mismatches), 0.0f, 0.0f);
+    }
+
+    {
+        constexpr size_t N = 40;
+        int16_t in[N], out[N];
+        for (size_t i = 0; i < N; ++i) {
+            in[i] = q412::from_float(-7.5f + 15.0f * float(i) / float(N - 1)).raw();
+        }
+        q_array<4, 12, fp::test::Backend> x(in, N), y(out, N);
+        x.sigmoid<fp::fast>(y);
+
+        float worst = 0.0f;
+        for (size_t i = 0; i < N; ++i) {
+            float v = q412(in[i]).to_float();
+            worst = std::max(worst, std::fabs(q412(out[i]).to_float() - 1.0f / (1.0f + std::exp(-v))));
+        }
+        expect_near("array sigmoid<fast> Q4.12", worst, 0.0f, 1e-4f + lsb12);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_activation_tests();
+    return 0;
+}
+#endif
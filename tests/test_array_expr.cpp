@@ -0,0 +1,126 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cmath>
+
+namespace fp {
+namespace test {
+
+void run_array_expr_tests() {
+    using B = fp::test::Backend;
+    using q31  = q<1, 31, B>;
+    using q15  = q<16, 15, B>;
+    using q1_15 = q<1, 15, B>;
+
+    std::puts("\n--- Array Expression Tests ---");
+
+    // y = a*b + c*d fused vs. elemult / elemult / add, including saturation
+    {
+        constexpr size_t N = 101;
+        int32_t a[N], b[N], c[N], d[N], y[N], t1[N], t2[N], ref[N];
+        for (size_t i = 0; i < N; ++i) {
+            float t = float(i) / float(N - 1);
+            a[i] = q31::from_float(-0.99f + 1.98f * t).raw();
+            b[i] = q31::from_float(0.9f - 1.7f * t * t).raw();
+            c[i] = q31::from_float(0.95f * std::sin(7.0f * t)).raw();
+            d[i] = q31::from_float(0.97f - t).raw();
+        }
+        q_array<1, 31, B> A(a, N), Bv(b, N), C(c, N), D(d, N), Y(y, N);
+        q_array<1, 31, B> T1(t1, N), T2(t2, N), R(ref, N);
+
+        Y.assign(A * Bv + C * D);
+        A.elemult(Bv, T1);
+        C.elemult(D, T2);
+        T1.add(T2, R);
+
+        int mismatches = 0;
+        for (size_t i = 0; i < N; ++i) mismatches += (y[i] != ref[i]);
+        expect_near("a*b + c*d == elemult/elemult/add (Q1.31)", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // y = a*g - c with a FixedPoint gain vs. scale + sub
+    {
+        constexpr size_t N = 64;
+        int32_t a[N], c[N], y[N], s[N], ref[N];
+        for (size_t i = 0; i < N; ++i) {
+            a[i] = q15::from_float(-300.0f + 9.5f * float(i)).raw();
+            c[i] = q15::from_float(12.25f - 0.75f * float(i)).raw();
+            s[i] = a[i];
+        }
+        auto g = q15::from_float(-1.375f);
+        q_array<16, 15, B> A(a, N), C(c, N), Y(y, N), S(s, N), R(ref, N);
+
+        Y.assign(A * g - C);
+        S.scale(g);
+        S.sub(C, R);
+
+        int mismatches = 0;
+        for (size_t i = 0; i < N; ++i) mismatches += (y[i] != ref[i]);
+        expect_near("a*g - c == scale/sub (Q16.15)", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // Mixed formats follow FixedPoint: result in the lhs format
+    {
+        constexpr size_t N = 9;
+        int32_t a[N], b[N], y[N];
+        for (size_t i = 0; i < N; ++i) {
+            a[i] = q15::from_float(-2.0f + 0.5f * float(i)).raw();
+            b[i] = q31::from_float(-0.8f + 0.2f * float(i)).raw();
+        }
+        q_array<16, 15, B> A(a, N), Y(y, N);
+        q_array<1, 31, B> Bv(b, N);
+
+        int mismatches = 0;
+        Y.assign(A + Bv);
+        for (size_t i = 0; i < N; ++i) mismatches += (y[i] != (q15(a[i]) + q31(b[i])).raw());
+        Y.assign(A * Bv);
+        for (size_t i = 0; i < N; ++i) mismatches += (y[i] != (q15(a[i]) * q31(b[i])).raw());
+        expect_near("mixed Q16.15 (+,*) Q1.31 == scalar", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // Explicit and destination conversions
+    {
+        constexpr size_t N = 5;
+        int32_t a[N] = {q15::from_float(0.25f).raw(), q15::from_float(-0.5f).raw(),
+                        q15::from_float(3.0f).raw(), q15::from_float(-7.0f).raw(), 1};
+        int32_t y[N];
+        int16_t z[N];
+        q_array<16, 15, B> A(a, N);
+        q_array<1, 31, B> Y(y, N);
+        q_array<1, 15, B> Z(z, N);
+
+        Y.assign(fp::as<1, 31>(A));
+        expect_near("assign Q16.15 -> Q1.31 (0.25)", q31(y[0]).to_float(), 0.25f, 0.0f);
+        expect_near("assign Q16.15 -> Q1.31 (-0.5)", q31(y[1]).to_float(), -0.5f, 0.0f);
+        expect_near("assign Q16.15 -> Q1.31 saturates", float(y[2]), float(INT32_MAX), 0.0f);
+        expect_near("assign Q16.15 -> Q1.31 saturates (neg)", float(y[3]), float(INT32_MIN), 0.0f);
+
+        Z.assign(fp::as<1, 31>(A * q15::from_float(0.5f)));
+        expect_near("as<1,31>(a*0.5) -> Q1.15", q1_15(z[0]).to_float(), 0.125f, 0.0f);
+        expect_near("as<1,31>(a*0.5) -> Q1.15 (neg)", q1_15(z[1]).to_float(), -0.25f, 0.0f);
+        expect_near("as<1,31>(a*0.5) -> Q1.15 saturates", float(z[2]), 32767.0f, 0.0f);
+    }
+
+    // 16-bit: saturating negation and aliasing the destination with an operand
+    {
+        constexpr size_t N = 4;
+        int16_t a[N] = {-32768, -1, 12000, 30000};
+        int16_t b[N] = {16384, 16384, 16384, 16384};   // 0.5
+        q_array<1, 15, B> A(a, N), Bv(b, N);
+
+        A.assign(-A * Bv + A);   // in-place: a = a - a*0.5, with -(-1.0) saturating first
+        expect_near("alias: -(-1)*0.5 + (-1)", float(a[0]), float(-32768 + 16384), 1.0f);
+        expect_near("alias: -x*0.5 + x (12000)", float(a[2]), 6000.0f, 0.0f);
+        expect_near("alias: -x*0.5 + x (30000)", float(a[3]), 15000.0f, 0.0f);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_array_expr_tests();
+    return 0;
+}
+#endif
@@ -1,8 +1,131 @@
 #include "test_common.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 
 namespace fp {
 namespace test {
 
+// fp::convert against the scalar definition (round_shift + saturate) and the
+// fp::as<> expression, for every value in src
+template<int I, int F, int OI, int OF, typename S>
+static void check_convert(const S* src, size_t n)
+{
+    using D = Storage_t<OI + OF>;
+    std::vector<S> in(src, src + n);
+    std::vector<D> out(n), via_expr(n);
+    FixedPointArray<I, F, Backend> X(in.data(), n);
+    FixedPointArray<OI, OF, Backend> Y(out.data(), n), E(via_expr.data(), n);
+    fp::convert(X, Y);
+    E.assign(fp::as<OI, OF>(X));
+
+    int bad_convert = 0, bad_expr = 0;
+    for (size_t i = 0; i < n; ++i) {
+        D want = sat_cast<D>(round_shift(static_cast<long long>(in[i]), F - OF));
+        bad_convert += (out[i] != want);
+        bad_expr += (via_expr[i] != want);
+    }
+    expect_exact(bad_convert, "convert Q%d.%d -> Q%d.%d", I, F, OI, OF);
+    expect_exact(bad_expr, "as<%d, %d>(Q%d.%d)", OI, OF, I, F);
+}
+
+// from_floats / to_floats against the scalar FixedPoint(float) / to_float()
+template<int I, int F>
+static void check_float_conversion(const std::vector<float>& src)
+{
+    using Q = FixedPoint<I, F, Backend>;
+    using S = Storage_t<I + F>;
+    std::vector<S> raw(src.size());
+    std::vector<float> back(src.size());
+    FixedPointArray<I, F, Backend> X(raw.data(), raw.size());
+    X.from_floats(src.data(), src.size());
+    X.to_floats(back.data());
+
+    int bad_from = 0, bad_to = 0;
+    for (size_t i = 0; i < src.size(); ++i) {
+        Q want(src[i]);
+        bad_from += (raw[i] != want.raw());
+        bad_to += (back[i] != want.to_float());
+    }
+    expect_exact(bad_from, "from_floats Q%d.%d", I, F);
+    expect_exact(bad_to, "to_floats Q%d.%d", I, F);
+}
+
+// Mixed-format elemult / add / sub against the scalar mul / add / sub<OI, OF>
+// on every pair (a[i], b[i])
+template<int I, int F, int YI, int YF, int OI, int OF, typename SA, typename SB>
+static void check_mixed_ops(const std::vector<SA>& a, const std::vector<SB>& b)
+{
+    using X = FixedPoint<I, F, Backend>;
+    using Y = FixedPoint<YI, YF, Backend>;
+    using D = Storage_t<OI + OF>;
+    std::vector<SA> in1(a);
+    std::vector<SB> in2(b);
+    std::vector<D> prod(a.size()), sum(a.size()), diff(a.size());
+    FixedPointArray<I, F, Backend> A(in1.data(), in1.size());
+    FixedPointArray<YI, YF, Backend> B(in2.data(), in2.size());
+    FixedPointArray<OI, OF, Backend> P(prod.data(), prod.size()), S(sum.data(), sum.size()),
+                                     Df(diff.data(), diff.size());
+    A.elemult(B, P);
+    A.add(B, S);
+    A.sub(B, Df);
+
+    int bad_mul = 0, bad_add = 0, bad_sub = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        X x(a[i]);
+        Y y(b[i]);
+        bad_mul += (prod[i] != x.template mul<OI, OF>(y).raw());
+        bad_add += (sum[i] != x.template add<OI, OF>(y).raw());
+        bad_sub += (diff[i] != x.template sub<OI, OF>(y).raw());
+    }
+    expect_exact(bad_mul, "elemult Q%d.%d x Q%d.%d -> Q%d.%d", I, F, YI, YF, OI, OF);
+    expect_exact(bad_add, "add Q%d.%d + Q%d.%d -> Q%d.%d", I, F, YI, YF, OI, OF);
+    expect_exact(bad_sub, "sub Q%d.%d - Q%d.%d -> Q%d.%d", I, F, YI, YF, OI, OF);
+}
+
+// BLAS level-1 kernels against the scalar expressions they fuse; asum and
+// nrm2 against the exact sums
+template<int AI, int AF, int XI, int XF, int YI, int YF, typename SX, typename SY>
+static void check_blas(const std::vector<SX>& x, const std::vector<SY>& y,
+                       Storage_t<AI + AF> alpha_raw, Storage_t<AI + AF> beta_raw)
+{
+    using A = FixedPoint<AI, AF, Backend>;
+    using X = FixedPoint<XI, XF, Backend>;
+    using Y = FixedPoint<YI, YF, Backend>;
+    const A alpha(alpha_raw), beta(beta_raw);
+    std::vector<SX> in(x), scaled(x);
+    std::vector<SY> ax(y), abx(y);
+    FixedPointArray<XI, XF, Backend> Xa(in.data(), in.size()), Xs(scaled.data(), scaled.size());
+    FixedPointArray<YI, YF, Backend> Y1(ax.data(), ax.size()), Y2(abx.data(), abx.size());
+    Y1.axpy(alpha, Xa);
+    Y2.axpby(alpha, Xa, beta);
+    Xs.scale(alpha);
+
+    int bad_axpy = 0, bad_axpby = 0, bad_scale = 0;
+    int64_t abs_sum = 0;
+    double sum_sq = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        X xi(x[i]);
+        Y yi(y[i]);
+        bad_axpy += (ax[i] != (yi + alpha.template mul<YI, YF>(xi)).raw());
+        bad_axpby += (abx[i] != (alpha.template mul<YI, YF>(xi) + beta.template mul<YI, YF>(yi)).raw());
+        bad_scale += (scaled[i] != xi.template mul<XI, XF>(alpha).raw());
+        abs_sum += std::abs(int64_t(x[i]));
+        sum_sq += double(x[i]) * double(x[i]);
+    }
+    int bad_asum = (Xa.asum().raw() != sat_cast<SX>(round_shift(abs_sum, 0)));
+    bad_asum += (Xa.template asum<16, 15>().raw() != sat_cast<int32_t>(round_shift(abs_sum, XF - 15)));
+    int bad_nrm2 = (Xa.nrm2().raw() != sat_cast<SX>(std::llround(std::sqrt(sum_sq))));
+    bad_nrm2 += (Xa.template nrm2<8, 24>().raw() !=
+                 sat_cast<int32_t>(std::llround(std::ldexp(std::sqrt(sum_sq), 24 - XF))));
+    expect_exact(bad_axpy, "axpy Q%d.%d * Q%d.%d + Q%d.%d", AI, AF, XI, XF, YI, YF);
+    expect_exact(bad_axpby, "axpby Q%d.%d * Q%d.%d + b * Q%d.%d", AI, AF, XI, XF, YI, YF);
+    expect_exact(bad_scale, "scale Q%d.%d by Q%d.%d", XI, XF, AI, AF);
+    expect_exact(bad_asum, "asum Q%d.%d", XI, XF);
+    expect_exact(bad_nrm2, "nrm2 Q%d.%d", XI, XF);
+}
+
 void run_array_ops_tests() {
     using q16 = q<1, 15, Backend>;
     using q8  = q<1, 7, Backend>;
@@ -99,6 +222,341 @@ void run_array_ops_tests() {
         expect_near("Reference backend array_min", got_min, want_min, 2.0f * lsb);
         expect_near("Reference backend array_max", got_max, want_max, 2.0f * lsb);
     }
+
+    std::puts("\n--- Array Element-wise Min/Max/Abs/Clip Tests ---");
+
+    // Element-wise max/min against a scalar loop, Q1.15 and Q1.31
+    {
+        constexpr size_t N = 37;
+        int16_t a[N], b[N], hi[N], lo[N];
+        int32_t a32[N], b32[N], hi32[N], lo32[N];
+        for (size_t i = 0; i < N; ++i) {
+            a[i] = static_cast<int16_t>((int(i) * 2731) % 65536 - 32768);
+            b[i] = static_cast<int16_t>((int(i) * 977 + 12345) % 65536 - 32768);
+            a32[i] = a[i] * 65536 + int32_t(i);
+            b32[i] = b[i] * 65536 - int32_t(i);
+        }
+        fp::FixedPointArray<1, 15, Backend> A(a, N), B(b, N), H(hi, N), L(lo, N);
+        fp::FixedPointArray<1, 31, Backend> A32(a32, N), B32(b32, N), H32(hi32, N), L32(lo32, N);
+        A.max(B, H);
+        A.min(B, L);
+        A32.max(B32, H32);
+        A32.min(B32, L32);
+
+        int mismatches = 0;
+        for (size_t i = 0; i < N; ++i) {
+            mismatches += (hi[i] != std::max(a[i], b[i])) + (lo[i] != std::min(a[i], b[i]));
+            mismatches += (hi32[i] != std::max(a32[i], b32[i])) + (lo32[i] != std::min(a32[i], b32[i]));
+        }
+        expect_near("element-wise max/min Q1.15 + Q1.31", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // abs saturates the most negative value
+    {
+        int16_t in[] = {INT16_MIN, -1, 0, 1234, -32767};
+        int16_t out[5];
+        fp::FixedPointArray<1, 15, Backend> X(in, 5), Y(out, 5);
+        X.abs(Y);
+        bool ok = out[0] == 32767 && out[1] == 1 && out[2] == 0 && out[3] == 1234 && out[4] == 32767;
+        expect_near("abs Q1.15 (INT16_MIN saturates)", float(ok), 1.0f, 0.0f);
+
+        int32_t in32[] = {INT32_MIN, -5, 7};
+        int32_t out32[3];
+        fp::FixedPointArray<1, 31, Backend> X32(in32, 3), Y32(out32, 3);
+        X32.abs(Y32);
+        ok = out32[0] == INT32_MAX && out32[1] == 5 && out32[2] == 7;
+        expect_near("abs Q1.31 (INT32_MIN saturates)", float(ok), 1.0f, 0.0f);
+    }
+
+    // max/min/abs on slices one element past an 8-byte boundary (NatureDSP's
+    // element-wise kernels need aligned pointers, so these take the fallback)
+    {
+        constexpr size_t N = 21;
+        alignas(8) int16_t a[N + 1], b[N + 1], r[N + 1];
+        alignas(8) int32_t a32[N + 1], b32[N + 1], r32[N + 1];
+        for (size_t i = 0; i <= N; ++i) {
+            a[i] = static_cast<int16_t>(int(i * 7919 % 65536) - 32768);
+            b[i] = static_cast<int16_t>(int(i * 104729 % 65536) - 32768);
+            a32[i] = a[i] * 65536 + int32_t(i);
+            b32[i] = b[i] * 65536 - int32_t(i);
+        }
+        fp::FixedPointArray<1, 15, Backend> A(a + 1, N), B(b + 1, N), R(r + 1, N);
+        fp::FixedPointArray<1, 31, Backend> A32(a32 + 1, N), B32(b32 + 1, N), R32(r32 + 1, N);
+        int mismatches = 0;
+        A.max(B, R);
+        A32.min(B32, R32);
+        for (size_t i = 1; i <= N; ++i) {
+            mismatches += (r[i] != std::max(a[i], b[i])) + (r32[i] != std::min(a32[i], b32[i]));
+        }
+        A.abs(R);
+        A32.abs(R32);
+        for (size_t i = 1; i <= N; ++i) {
+            mismatches += (r[i] != (a[i] == INT16_MIN ? INT16_MAX : std::abs(a[i])));
+            mismatches += (r32[i] != (a32[i] == INT32_MIN ? INT32_MAX : std::abs(a32[i])));
+        }
+        expect_near("max/min/abs on unaligned slices", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // clip, ReLU via threshold, and select; in place where the API allows it
+    {
+        float vals[] = {-0.9f, -0.3f, 0.0f, 0.2f, 0.6f, 0.95f};
+        constexpr size_t N = sizeof(vals) / sizeof(vals[0]);
+        int16_t x[N], clipped[N], relu[N], up[N], down[N], sel[N];
+        for (size_t i = 0; i < N; ++i) {
+            x[i] = q16::from_float(vals[i]).raw();
+            up[i] = q16::from_float(0.5f).raw();
+            down[i] = q16::from_float(-0.5f).raw();
+        }
+        fp::FixedPointArray<1, 15, Backend> X(x, N), C(clipped, N), R(relu, N),
+                                            U(up, N), D(down, N), S(sel, N);
+        X.clip(q16::from_float(-0.25f), q16::from_float(0.5f), C);
+        X.threshold(q16::from_float(0.0f), q16::from_float(0.0f), R);
+        X.select(q16::from_float(0.1f), U, D, S);
+
+        float worst = 0.0f;
+        for (size_t i = 0; i < N; ++i) {
+            float v = q16(x[i]).to_float();
+            float want_c = std::min(std::max(v, q16::from_float(-0.25f).to_float()),
+                                    q16::from_float(0.5f).to_float());
+            worst = std::max(worst, std::fabs(q16(clipped[i]).to_float() - want_c));
+            worst = std::max(worst, std::fabs(q16(relu[i]).to_float() - std::max(v, 0.0f)));
+            worst = std::max(worst, std::fabs(q16(sel[i]).to_float() - (v > 0.1f ? 0.5f : -0.5f)));
+        }
+        expect_near("clip / threshold (ReLU) / select Q1.15", worst, 0.0f, 0.0f);
+
+        X.clip(q16::from_float(-0.25f), q16::from_float(0.5f), X);
+        int mismatches = 0;
+        for (size_t i = 0; i < N; ++i) mismatches += (x[i] != clipped[i]);
+        expect_near("clip in place", float(mismatches), 0.0f, 0.0f);
+    }
+
+    std::puts("\n--- Array Argmin/Argmax/Top-k/Peak Tests ---");
+
+    // argmin/argmax agree with std::min_element/max_element (first occurrence),
+    // including lengths that leave a partial tail after the lanes
+    {
+        int mismatches = 0;
+        for (size_t n = 1; n <= 23; ++n) {
+            int16_t d[23];
+            int32_t d32[23];
+            for (size_t i = 0; i < n; ++i) {
+                d[i] = static_cast<int16_t>(((int(i) * 7919 + int(n) * 31) % 13) * 1000 - 6000);
+                d32[i] = d[i] * 3;
+            }
+            fp::FixedPointArray<1, 15, Backend> X(d, n);
+            fp::FixedPointArray<1, 31, Backend> X32(d32, n);
+            auto mn = X.argmin(), mx = X.argmax();
+            auto mx32 = X32.argmax();
+            size_t want_mn = size_t(std::min_element(d, d + n) - d);
+            size_t want_mx = size_t(std::max_element(d, d + n) - d);
+            mismatches += (mn.index != want_mn) + (mn.value.raw() != d[want_mn]);
+            mismatches += (mx.index != want_mx) + (mx.value.raw() != d[want_mx]);
+            mismatches += (mx32.index != want_mx) + (mx32.value.raw() != d32[want_mx]);
+        }
+        expect_near("argmin/argmax == first min/max_element (n = 1..23)", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // top-k: descending, ties by lower index, K larger than the array
+    {
+        int16_t d[] = {5, -3, 9, 9, 1, 7, -8, 7, 2};
+        fp::FixedPointArray<1, 15, Backend> X(d, 9);
+        fp::ArrayExtremum<1, 15, Backend> top[4];
+        size_t n = X.top_k(top);
+        bool ok = n == 4 &&
+                  top[0].index == 2 && top[1].index == 3 && top[2].index == 5 && top[3].index == 7 &&
+                  top[0].value.raw() == 9 && top[2].value.raw() == 7;
+        expect_near("top_k<4>", float(ok), 1.0f, 0.0f);
+
+        fp::FixedPointArray<1, 15, Backend> S(d, 3);
+        fp::ArrayExtremum<1, 15, Backend> all[5];
+        n = S.top_k(all);
+        ok = n == 3 && all[0].index == 2 && all[1].index == 0 && all[2].index == 1;
+        expect_near("top_k<5> on 3 elements", float(ok), 1.0f, 0.0f);
+    }
+
+    // Peak picking: threshold, plateaus, end points, and the output limit
+    {
+        //              0  1  2  3  4  5  6  7  8  9 10 11 12
+        int16_t d[] = {9, 2, 6, 3, 3, 8, 8, 1, 4, 4, 5, 2, 7};
+        fp::FixedPointArray<1, 15, Backend> X(d, 13);
+        size_t idx[8];
+        size_t n = X.find_peaks(q16(int16_t(2)), idx, 8);
+        bool ok = n == 3 && idx[0] == 2 && idx[1] == 5 && idx[2] == 10;
+        expect_near("find_peaks (plateau once, ends excluded)", float(ok), 1.0f, 0.0f);
+
+        n = X.find_peaks(q16(int16_t(5)), idx, 8);
+        ok = n == 2 && idx[0] == 2 && idx[1] == 5;
+        expect_near("find_peaks threshold", float(ok), 1.0f, 0.0f);
+
+        n = X.find_peaks(q16(int16_t(0)), idx, 1);
+        ok = n == 1 && idx[0] == 2;
+        expect_near("find_peaks max_peaks", float(ok), 1.0f, 0.0f);
+    }
+
+    std::puts("\n--- Q-Format Conversion Tests ---");
+
+    // 16-bit sources: every value, narrowing / widening / same bucket
+    {
+        std::vector<int16_t> all;
+        for (int v = -32768; v < 32768; ++v) all.push_back(static_cast<int16_t>(v));
+        check_convert<1, 15, 1, 7>(all.data(), all.size());     // 16 -> 8, >> 8
+        check_convert<4, 12, 1, 7>(all.data(), all.size());     // 16 -> 8, >> 5, saturating
+        check_convert<1, 15, 1, 31>(all.data(), all.size());    // 16 -> 32, << 16
+        check_convert<4, 12, 8, 24>(all.data(), all.size());    // 16 -> 32, << 12
+        check_convert<1, 15, 4, 12>(all.data(), all.size());    // 16 -> 16, >> 3
+        check_convert<4, 12, 1, 15>(all.data(), all.size());    // 16 -> 16, << 3, saturating
+    }
+
+    // 8-bit sources: every value
+    {
+        int8_t all[256];
+        for (int v = 0; v < 256; ++v) all[v] = static_cast<int8_t>(v - 128);
+        check_convert<1, 7, 1, 15>(all, 256);       // 8 -> 16, << 8
+        check_convert<4, 4, 2, 14>(all, 256);       // 8 -> 16, << 10
+        check_convert<1, 7, 4, 4>(all, 256);        // 8 -> 8, >> 3
+        check_convert<1, 7, 8, 24>(all, 256);       // 8 -> 32, << 17
+    }
+
+    // 32-bit sources: extremes, rounding ties and a pseudo-random sweep
+    {
+        std::vector<int32_t> vals = {INT32_MIN, INT32_MIN + 1, -65536 - 32768, -32768, -32769,
+                                     -1, 0, 1, 32767, 32768, 65536 + 32768, INT32_MAX - 1, INT32_MAX};
+        Lcg rng(7);
+        for (int i = 0; i < 20000; ++i) vals.push_back(rng.raw<int32_t>() >> (i % 20));
+        check_convert<1, 31, 1, 15>(vals.data(), vals.size());  // 32 -> 16, >> 16
+        check_convert<8, 24, 4, 12>(vals.data(), vals.size());  // 32 -> 16, >> 12, saturating
+        check_convert<8, 24, 1, 7>(vals.data(), vals.size());   // 32 -> 8, >> 17
+        check_convert<8, 24, 1, 31>(vals.data(), vals.size());  // 32 -> 32, << 7, saturating
+        check_convert<1, 31, 5, 26>(vals.data(), vals.size());  // 32 -> 32, >> 5
+    }
+
+    // Same storage type in place
+    {
+        int16_t d[] = {-32768, -5, -4, -3, 3, 4, 5, 32767};
+        fp::FixedPointArray<1, 15, Backend> X(d, 8);
+        fp::FixedPointArray<3, 13, Backend> Y(d, 8);
+        fp::convert(X, Y);
+        bool ok = d[0] == -8192 && d[1] == -1 && d[2] == -1 && d[3] == -1 &&
+                  d[4] == 1 && d[5] == 1 && d[6] == 1 && d[7] == 8192;
+        expect_near("convert in place Q1.15 -> Q3.13", float(ok), 1.0f, 0.0f);
+    }
+
+    std::puts("\n--- Float Conversion Tests ---");
+
+    // Random values over and beyond the range, exact rounding ties, values
+    // just below a tie, and the saturation bounds; odd length for the tails
+    {
+        std::vector<float> src;
+        Lcg rng(99);
+        for (int i = 0; i < 40001; ++i) src.push_back((rng.uniform() - 0.5f) * std::ldexp(1.0f, (i % 40) - 16));
+        for (int k = -40; k <= 40; ++k) {
+            src.push_back(float(k) + 0.5f);
+            src.push_back(std::nextafter(float(k) + 0.5f, 0.0f));
+            src.push_back((float(k) + 0.5f) / 32768.0f);
+            src.push_back((float(k) + 0.5f) / 128.0f);
+        }
+        const float edges[] = {1.0f, -1.0f, 0.99998f, 0.999999f, -0.999999f, 127.0f, 128.0f, -128.0f,
+                               -129.0f, 255.99f, 32767.5f, 65536.0f, -65536.0f, 2147483648.0f, 4e9f, -4e9f, 0.0f, -0.0f};
+        for (float e : edges) src.push_back(e);
+
+        check_float_conversion<1, 15>(src);
+        check_float_conversion<8, 8>(src);
+        check_float_conversion<1, 7>(src);
+        check_float_conversion<4, 4>(src);
+        check_float_conversion<1, 31>(src);
+        check_float_conversion<8, 24>(src);
+        check_float_conversion<17, 15>(src);
+    }
+
+    {
+        float src[5] = {0.25f, std::nanf(""), -0.5f, 9.0f, 0.125f};
+        int16_t raw[4] = {7, 7, 7, 7};
+        FixedPointArray<1, 15, Backend> X(raw, 4);
+        X.from_floats(src, 5);
+        bool ok = raw[0] == 8192 && raw[1] == 0 && raw[2] == -16384 && raw[3] == 32767;
+        expect_near("from_floats: NaN -> 0, count clipped to length", float(ok), 1.0f, 0.0f);
+    }
+
+    std::puts("\n--- Mixed-Format Array Op Tests ---");
+
+    // Pseudo-random operands plus the extremes; odd length for the tails
+    {
+        std::vector<int32_t> a32, b32;
+        std::vector<int16_t> a16, b16;
+        std::vector<int8_t> b8;
+        const int32_t ext32[] = {INT32_MIN, INT32_MIN + 1, -1, 0, 1, INT32_MAX};
+        const int16_t ext16[] = {INT16_MIN, INT16_MIN + 1, -1, 0, 1, INT16_MAX};
+        for (int32_t x : ext32) for (int32_t y : ext32) { a32.push_back(x); b32.push_back(y); }
+        for (int16_t x : ext16) for (int16_t y : ext16) { a16.push_back(x); b16.push_back(y); }
+        Lcg rng(2024);
+        while (a32.size() < 10001) {
+            uint32_t u = rng.next(), v = rng.next();
+            a32.push_back(static_cast<int32_t>(u) >> (u % 13));
+            b32.push_back(static_cast<int32_t>(v) >> (v % 17));
+        }
+        while (a16.size() < a32.size()) {
+            a16.push_back(static_cast<int16_t>(a32[a16.size()] >> 16));
+            b16.push_back(static_cast<int16_t>(b32[b16.size()]));
+        }
+        for (size_t i = 0; i < a32.size(); ++i) b8.push_back(static_cast<int8_t>(b32[i] >> 5));
+
+        check_mixed_ops<1, 31, 5, 26, 1, 31>(a32, b32);     // Q1.31 x Q5.26 -> Q1.31
+        check_mixed_ops<1, 31, 1, 15, 1, 31>(a32, b16);     // 32 x 16 -> 32
+        check_mixed_ops<1, 31, 4, 12, 1, 15>(a32, b16);     // 32 x 16 -> 16, saturating
+        check_mixed_ops<1, 15, 1, 15, 8, 24>(a16, b16);     // 16 x 16 -> 32, widening
+        check_mixed_ops<1, 15, 4, 12, 1, 15>(a16, b16);     // 16 x 16 -> 16
+        check_mixed_ops<4, 12, 1, 7, 1, 7>(a16, b8);        // 16 x 8 -> 8
+        check_mixed_ops<1, 15, 1, 7, 4, 28>(a16, b8);       // left-shifted product
+        check_mixed_ops<8, 8, 2, 14, 4, 12>(a16, b16);      // add aligns one left, one right
+    }
+
+    {
+        int32_t x[3] = {1 << 30, -(1 << 30), INT32_MAX};            // 0.5, -0.5, ~1.0 in Q1.31
+        int32_t c[3] = {1 << 27, 3 << 26, -(1 << 30)};              // 2.0, 3.0, -16.0 in Q5.26
+        int32_t y[3];
+        FixedPointArray<1, 31, Backend> X(x, 3), Y(y, 3);
+        FixedPointArray<5, 26, Backend> C(c, 3);
+        X.elemult(C, Y);
+        bool ok = y[0] == INT32_MAX && y[1] == INT32_MIN && y[2] == INT32_MIN;
+        FixedPointArray<5, 26, Backend> Z(c, 3);
+        X.elemult(C, Z);                                            // output aliases C
+        ok = ok && c[0] == (1 << 26) && c[1] == -(3 << 25) && c[2] == -(1 << 30);
+        expect_near("mixed elemult Q1.31 x Q5.26 (saturation, aliasing)", float(ok), 1.0f, 0.0f);
+    }
+
+    // BLAS level-1: axpy / axpby / scale / asum / nrm2 across formats
+    {
+        std::vector<int32_t> x32, y32;
+        std::vector<int16_t> x16, y16;
+        std::vector<int8_t> x8;
+        Lcg rng(203);
+        for (int i = 0; i < 203; ++i) {
+            int32_t v = rng.raw<int32_t>();
+            x32.push_back(v);
+            y32.push_back(rng.raw<int32_t>());
+            x16.push_back(static_cast<int16_t>(v >> 16));
+            y16.push_back(static_cast<int16_t>(v >> 3));
+            x8.push_back(static_cast<int8_t>(v >> 24));
+        }
+        std::vector<int32_t> small32;
+        for (int32_t v : x32) small32.push_back(v >> 10);         // nrm2 reference stays exact in double
+
+        check_blas<1, 15, 1, 15, 1, 15>(x16, y16, -21000, 12345);         // 16-bit, int32 loop
+        check_blas<1, 31, 1, 15, 1, 31>(x16, y32, 1500000000, -(7 << 27)); // 32 x 16 -> 32
+        check_blas<1, 15, 1, 31, 4, 12>(small32, y16, 30000, -32768);     // 16 x 32 -> 16, saturating
+        check_blas<8, 24, 1, 31, 1, 31>(small32, y32, 3 << 24, -(1 << 23)); // gain > 1
+        check_blas<1, 7, 1, 7, 1, 15>(x8, y16, 100, -128);                 // 8-bit, widening
+        check_blas<1, 31, 4, 12, 4, 12>(x16, y16, INT32_MIN, 1 << 30);    // 32-bit gain on 16-bit data
+        check_blas<1, 15, 4, 12, 1, 15>(x16, y16, 30000, -20000);         // product saturates before the add
+
+        // nrm2 of 32-bit data whose sum of squares passes 2^63, into a
+        // format wide enough to hold it
+        std::vector<int32_t> big(64, INT32_MIN);
+        FixedPointArray<1, 31, Backend> B(big.data(), big.size());
+        bool ok = B.nrm2<5, 26>().raw() == (8 << 26) && B.nrm2().raw() == INT32_MAX;
+        ok = ok && B.asum<8, 24>().raw() == (64 << 24);
+        expect_near("nrm2/asum of a full-scale 32-bit vector", float(ok), 1.0f, 0.0f);
+    }
 }
 
 } // namespace test
@@ -2,6 +2,7 @@
 #include "../fp.hpp"
 #include <cstdio>
 #include <cmath>
+#include <cstdint>
 
 namespace fp {
 namespace test {
@@ -28,6 +29,32 @@ inline void expect_near(const char* name, float got, float want, float eps) {
     }
 }
 
+// Helper: Expect no mismatching elements; name is a printf format, so each
+// op / Q format of a sweep gets its own line (e.g. "add Q%d.%d", I, F)
+template<typename... Args>
+inline void expect_exact(int mismatches, const char* name_fmt, Args... args) {
+    char name[128];
+    std::snprintf(name, sizeof(name), name_fmt, args...);
+    expect_near(name, float(mismatches), 0.0f, 0.0f);
+}
+
+// Deterministic pseudo-random source for the randomized sweeps (32-bit LCG,
+// Numerical Recipes constants); the same seed gives the same data everywhere
+struct Lcg {
+    uint32_t state;
+
+    explicit Lcg(uint32_t seed) : state(seed) {}
+
+    uint32_t next() { return state = state * 1664525u + 1013904223u; }
+
+    // Full-range value of an integer type, from the high (better mixed) bits
+    template<typename T>
+    T raw() { return static_cast<T>(next() >> (32 - 8 * sizeof(T))); }
+
+    // Uniform in [0, 1)
+    float uniform() { return float(next() >> 8) / float(1u << 24); }
+};
+
 // Template helpers for multiply and divide tests
 template<typename QA, typename QB, int OutI, int OutF>
 void check_mul(const char* name, float a, float b, float eps_scale = 2.0f) {
@@ -0,0 +1,272 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+namespace fp {
+namespace test {
+
+// True when A::unchecked is callable from outside the owning containers
+template<typename A, typename = void>
+struct has_public_unchecked : std::false_type {};
+template<typename A>
+struct has_public_unchecked<A, std::void_t<decltype(A::unchecked(nullptr, 0))>> : std::true_type {};
+
+template<typename S>
+static bool aligned64(const S* p) {
+    return (reinterpret_cast<uintptr_t>(p) & (VECTOR_ALIGNMENT - 1)) == 0;
+}
+
+// FixedArray ops against the runtime-length FixedPointArray kernels on the
+// same data (full range, so saturation and rounding ties are covered)
+template<int I, int F, size_t N>
+static void check_fixed_array(uint32_t seed)
+{
+    using Arr = FixedArray<I, F, N, fp::test::Backend>;
+    using Q = FixedPoint<I, F, fp::test::Backend>;
+    using S = Storage_t<I + F>;
+    Arr a, b, c;
+    Lcg rng(seed);
+    for (size_t i = 0; i < N; ++i) {
+        a.raw()[i] = rng.raw<S>();
+        b.raw()[i] = static_cast<S>(rng.raw<S>() >> (i % 3));
+    }
+    S ref[N];
+    FixedPointArray<I, F, fp::test::Backend> r(ref, N);
+    auto mismatches = [&]() {
+        int bad = 0;
+        for (size_t i = 0; i < N; ++i) bad += (c.raw()[i] != ref[i]);
+        return bad;
+    };
+    const size_t n = N;
+
+    a.elemult(b, c);
+    a.view().elemult(b.view(), r);
+    expect_exact(mismatches(), "FixedArray<%d, %d, %zu> elemult", I, F, n);
+    a.add(b, c);
+    a.view().add(b.view(), r);
+    expect_exact(mismatches(), "FixedArray<%d, %d, %zu> add", I, F, n);
+    a.sub(b, c);
+    a.view().sub(b.view(), r);
+    expect_exact(mismatches(), "FixedArray<%d, %d, %zu> sub", I, F, n);
+    expect_exact(a.dot_product(b).raw() != a.view().dot_product(b.view()).raw(),
+                 "FixedArray<%d, %d, %zu> dot_product", I, F, n);
+
+    c = a;
+    std::copy(a.data(), a.data() + N, ref);
+    const int shifts[] = {3, -2, 0, -7, 1};
+    int bad_shift = 0;
+    for (int sh : shifts) {
+        c.shift(sh);
+        r.shift(sh);
+        bad_shift += mismatches();
+    }
+    expect_exact(bad_shift, "FixedArray<%d, %d, %zu> shift", I, F, n);
+    Q factor(b.raw()[0]);
+    c.scale(factor);
+    r.scale(factor);
+    expect_exact(mismatches(), "FixedArray<%d, %d, %zu> scale", I, F, n);
+}
+
+void run_fixed_vector_tests() {
+    using q16 = q<1, 15, fp::test::Backend>;
+    using vec16 = FixedVector<1, 15, fp::test::Backend>;
+    using vec32 = FixedVector<1, 31, fp::test::Backend>;
+
+    std::puts("\n--- FixedVector Tests ---");
+
+    // Alignment and padding to whole 64-byte blocks, padding zeroed
+    {
+        vec16 x(37, q16::from_float(0.25f));
+        vec32 y(5);
+        bool ok = aligned64(x.data()) && aligned64(y.data()) &&
+                  x.length() == 37 && x.padded_length() == 64 &&
+                  y.length() == 5 && y.padded_length() == 16;
+        expect_near("aligned to 64 bytes, padded to blocks", float(ok), 1.0f, 0.0f);
+
+        int bad = 0;
+        for (size_t i = 0; i < x.length(); ++i) bad += (x[i].raw() != q16::from_float(0.25f).raw());
+        for (size_t i = x.length(); i < x.padded_length(); ++i) bad += (x.data()[i] != 0);
+        expect_near("fill value, zero padding", float(bad), 0.0f, 0.0f);
+
+        expect_near("padded() sum equals sum", x.padded().sum().to_float(), x.sum().to_float(), 0.0f);
+    }
+
+    // A FixedVector is a FixedPointArray: array ops and expressions apply
+    {
+        vec16 a(20, q16::from_float(0.5f)), b(20, q16::from_float(-0.125f)), c(20);
+        a.add(b, c);
+        expect_near("add into FixedVector", c[19].to_float(), 0.375f, 0.0f);
+
+        c.assign(fp::as<1, 15>(a * b + c));
+        expect_near("lazy expression over FixedVectors", c[0].to_float(), 0.3125f, 0.0f);
+        expect_near("max() on FixedVector", c.max().to_float(), 0.3125f, 0.0f);
+    }
+
+    // Copy is deep, move transfers ownership, resize keeps the prefix
+    {
+        vec16 a(10, q16::from_float(0.5f));
+        vec16 b = a;
+        b.fill(q16::from_float(-0.5f));
+        bool ok = b.data() != a.data() && a[3].to_float() == 0.5f && b[3].to_float() == -0.5f;
+        expect_near("copy is deep", float(ok), 1.0f, 0.0f);
+
+        const int16_t* p = b.data();
+        vec16 m = std::move(b);
+        ok = m.data() == p && b.data() == nullptr && b.length() == 0 && m.length() == 10;
+        expect_near("move transfers storage", float(ok), 1.0f, 0.0f);
+
+        a = m;
+        ok = a.data() != m.data() && a[9].to_float() == -0.5f;
+        expect_near("copy assignment", float(ok), 1.0f, 0.0f);
+
+        a.resize(70);
+        int bad = 0;
+        for (size_t i = 0; i < 10; ++i) bad += (a[i].to_float() != -0.5f);
+        for (size_t i = 10; i < a.padded_length(); ++i) bad += (a.data()[i] != 0);
+        bad += !aligned64(a.data()) + (a.padded_length() != 96);
+        a.resize(3);
+        for (size_t i = 3; i < a.padded_length(); ++i) bad += (a.data()[i] != 0);
+        expect_near("resize keeps prefix, zeroes the rest", float(bad), 0.0f, 0.0f);
+    }
+
+    // Arena allocator: vectors carved from a caller buffer, null when exhausted
+    {
+        alignas(64) static unsigned char buffer[512];
+        Arena arena(buffer + 8, sizeof(buffer) - 8);
+        using arena_vec = FixedVector<1, 15, fp::test::Backend, ArenaAllocator<int16_t>>;
+        ArenaAllocator<int16_t> alloc(arena);
+
+        arena_vec x(40, alloc), y(40, q16::from_float(0.25f), alloc);
+        bool ok = aligned64(x.data()) && aligned64(y.data()) && x.length() == 40 &&
+                  reinterpret_cast<unsigned char*>(x.data()) >= buffer &&
+                  reinterpret_cast<unsigned char*>(y.data()) < buffer + sizeof(buffer);
+        expect_near("arena vectors aligned inside the buffer", float(ok), 1.0f, 0.0f);
+
+        y.add(y, x);
+        expect_near("arena vector add", x[39].to_float(), 0.5f, 0.0f);
+
+        // 448 bytes would fit the empty buffer but not what x and y left of it
+        arena_vec z(200, alloc);
+        expect_near("exhausted arena leaves the vector empty",
+                    float(z.data() == nullptr && z.length() == 0), 1.0f, 0.0f);
+    }
+
+    std::puts("\n--- AlignedArray Tests ---");
+
+    using fast16 = AlignedArray<1, 15, 8, 4, fp::test::Backend>;
+    using block16 = AlignedArray<1, 15, 64, 32, fp::test::Backend>;
+
+    // Only the weakening conversion exists
+    static_assert(std::is_convertible_v<block16, fast16>, "64/32 layout weakens to 8/4");
+    static_assert(!std::is_convertible_v<fast16, block16>, "8/4 layout must not strengthen");
+    static_assert(!std::is_constructible_v<fast16, int16_t*, size_t>, "views come from factories");
+    static_assert(!has_public_unchecked<block16>::value, "only FixedVector / FixedArray skip the check");
+
+    // Checked factories reject misaligned pointers and odd lengths
+    {
+        alignas(8) static int16_t buf[16] = {};
+        bool ok = fast16::from(buf).has_value() && fast16::from(buf, 12).has_value() &&
+                  !fast16::from(buf, 6).has_value() && !fast16::from(buf + 1, 8).has_value();
+        expect_near("from() checks alignment and length", float(ok), 1.0f, 0.0f);
+    }
+
+    // Static-layout kernels agree with the runtime-checked ones
+    {
+        vec16 a(40), b(40), c(40), d(40);
+        for (size_t i = 0; i < 40; ++i) {
+            a.data()[i] = static_cast<int16_t>(int(i) * 811 - 16000);
+            b.data()[i] = static_cast<int16_t>(12000 - int(i) * 577);
+        }
+        block16 A = a.aligned(), B = b.aligned(), C = c.aligned();
+        fast16 D = d.aligned();
+
+        A.add(B, C);
+        a.add(b, d);
+        int bad = 0;
+        for (size_t i = 0; i < 40; ++i) bad += (c.data()[i] != d.data()[i]);
+        A.sub(B, D);
+        a.sub(b, c);
+        for (size_t i = 0; i < 40; ++i) bad += (c.data()[i] != d.data()[i]);
+        A.elemult(B, C);
+        a.elemult(b, d);
+        for (size_t i = 0; i < 40; ++i) bad += (c.data()[i] != d.data()[i]);
+        expect_near("aligned add/sub/elemult == runtime path", float(bad), 0.0f, 0.0f);
+
+        expect_near("aligned dot == runtime dot", A.dot_product(B).to_float(),
+                    a.dot_product(b).to_float(), 0.0f);
+
+        C.shift(-2);
+        d.shift(-2);
+        C.scale(q16::from_float(0.5f));
+        d.scale(q16::from_float(0.5f));
+        bad = 0;
+        for (size_t i = 0; i < 40; ++i) bad += (c.data()[i] != d.data()[i]);
+        expect_near("aligned shift/scale == runtime path", float(bad), 0.0f, 0.0f);
+        expect_near("aligned view covers the padding", float(C.length()), 64.0f, 0.0f);
+    }
+
+    std::puts("\n--- FixedArray Tests ---");
+
+    // Static kernels == runtime kernels: whole blocks, leftovers, one element
+    {
+        check_fixed_array<1, 15, 64>(1);
+        check_fixed_array<4, 12, 128>(2);
+        check_fixed_array<1, 15, 67>(3);
+        check_fixed_array<1, 15, 1>(4);
+        check_fixed_array<1, 31, 64>(5);
+        check_fixed_array<8, 24, 13>(6);
+        check_fixed_array<1, 7, 100>(7);
+        check_fixed_array<8, 0, 40>(8);
+    }
+
+    // Storage, construction and interop with views
+    {
+        using arr16 = FixedArray<1, 15, 64, fp::test::Backend>;
+        using arr3 = FixedArray<1, 15, 3, fp::test::Backend>;
+        static_assert(sizeof(arr16) == 128 && alignof(arr16) == 64, "64-byte aligned, no overhead");
+        static_assert(alignof(arr3) == 8, "short arrays keep the 8-byte (*_fast) alignment");
+        static_assert(std::is_same_v<decltype(std::declval<arr16&>().view()), arr16::View>,
+                      "a FixedArray gives writable views");
+        static_assert(std::is_same_v<decltype(std::declval<const arr16&>().view()), const arr16::View> &&
+                      std::is_same_v<decltype(std::declval<const arr16&>().aligned()), const arr16::Aligned>,
+                      "a const FixedArray gives const views");
+
+        arr16 zeros;
+        arr16 x(q16::from_float(0.5f)), y(q16::from_float(0.25f)), z;
+        bool ok = zeros[0].raw() == 0 && zeros[63].raw() == 0 && x[10].to_float() == 0.5f;
+
+        x.add(y, z);
+        ok = ok && z[0].to_float() == 0.75f && z[63].to_float() == 0.75f;
+
+        // A FixedArray is a read-only FixedPointArray argument; view() and
+        // aligned() alias its storage
+        vec16 w(64, q16::from_float(0.5f));
+        ok = ok && w.dot_product(y).raw() == x.dot_product(y).raw();
+        z.view().shift(-1);
+        ok = ok && z[5].to_float() == 0.375f && z.aligned().data() == z.data();
+        z.aligned().scale(q16::from_float(0.5f));
+        ok = ok && z[5].to_float() == 0.1875f && z.aligned().length() == 64;
+
+        float f[64];
+        for (size_t i = 0; i < 64; ++i) f[i] = 0.01f * float(i) - 0.3f;
+        z.from_floats(f);
+        float back[64];
+        z.to_floats(back);
+        ok = ok && back[7] == q16(f[7]).to_float();
+        expect_near("FixedArray storage and view interop", float(ok), 1.0f, 0.0f);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_fixed_vector_tests();
+    return 0;
+}
+#endif
@@ -0,0 +1,114 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cmath>
+
+namespace fp {
+namespace test {
+
+void run_log_fixed_tests() {
+    using lq   = LogFixed<6, 25, fp::test::Backend>;
+    using q15  = q<16, 15, fp::test::Backend>;
+    using q31  = q<1, 31, fp::test::Backend>;
+    using q29  = q<3, 29, fp::test::Backend>;
+
+    std::puts("\n--- LogFixed Tests ---");
+
+    const float lsb15 = 1.0f / static_cast<float>(1u << 15);
+    const float lsb25 = 1.0f / static_cast<float>(1u << 25);
+
+    // Linear <-> log conversion
+    {
+        auto x = lq::from_linear(q15::from_float(8.0f));
+        expect_near("from_linear(8).log2", x.log2().to_float(), 3.0f, lsb25);
+        expect_near("to_linear(from_linear(8))", x.to_linear<16, 15>().to_float(), 8.0f, lsb15);
+    }
+
+    {
+        auto x = lq::from_linear(q15::from_float(-0.3f));
+        expect_near("from_linear(-0.3) sign", float(x.is_negative()), 1.0f, 0.0f);
+        expect_near("round trip -0.3", x.to_linear<16, 15>().to_float(), -0.3f, 2.0f * lsb15);
+    }
+
+    {
+        auto x = lq::from_linear(q15::from_float(0.0f));
+        expect_near("from_linear(0) is zero", float(x.is_zero()), 1.0f, 0.0f);
+        expect_near("zero to_linear", x.to_linear<16, 15>().to_float(), 0.0f, 0.0f);
+    }
+
+    // Multiply and divide are log add / subtract
+    {
+        auto a = lq::from_linear(q15::from_float(12.5f));
+        auto b = lq::from_linear(q15::from_float(-0.75f));
+        expect_near("12.5 * -0.75", (a * b).to_linear<16, 15>().to_float(), -9.375f, 4.0f * lsb15);
+        expect_near("12.5 / -0.75", (a / b).to_linear<16, 15>().to_float(), -16.6666667f, 8.0f * lsb15);
+        expect_near("x * 0 = 0", float((a * lq::zero()).is_zero()), 1.0f, 0.0f);
+        expect_near("x / 0 saturates", (a / lq::zero()).to_linear<16, 15>().to_float(), 65536.0f, 1.0f);
+    }
+
+    // Normalized step size: mu = alpha / (energy + eps) as one subtract
+    {
+        auto alpha  = lq::from_float(0.5f);
+        auto energy = lq::from_linear(q15::from_float(37.0f));
+        auto mu = (alpha / energy).to_linear<1, 31>();
+        expect_near("mu = 0.5 / 37", mu.to_float(), 0.5f / 37.0f, 1e-7f);
+    }
+
+    // Powers and roots are scaling of the log
+    {
+        auto x = lq::from_linear(q15::from_float(3.0f));
+        expect_near("3^4", x.pow(4).to_linear<16, 15>().to_float(), 81.0f, 16.0f * lsb15);
+        expect_near("3^-2", x.pow(-2).to_linear<16, 15>().to_float(), 1.0f / 9.0f, 2.0f * lsb15);
+        expect_near("(-3)^3", (-x).pow(3).to_linear<16, 15>().to_float(), -27.0f, 8.0f * lsb15);
+        expect_near("sqrt(3)", x.sqrt().to_linear<16, 15>().to_float(), std::sqrt(3.0f), 2.0f * lsb15);
+        expect_near("rsqrt(3)", x.rsqrt().to_linear<16, 15>().to_float(), 1.0f / std::sqrt(3.0f), 2.0f * lsb15);
+        expect_near("1/3", x.reciprocal().to_linear<16, 15>().to_float(), 1.0f / 3.0f, 2.0f * lsb15);
+        expect_near("3^1.5", x.pow(q29::from_float(1.5f)).to_linear<16, 15>().to_float(),
+                    std::pow(3.0f, 1.5f), 4.0f * lsb15);
+        expect_near("sqrt(-3) = 0", float((-x).sqrt().is_zero()), 1.0f, 0.0f);
+    }
+
+    // Gain chain: several multiplies without leaving the log domain
+    {
+        float gains[] = {0.9f, 1.7f, 0.25f, 3.0f, 0.6f};
+        auto g = lq::one();
+        float want = 1.0f;
+        for (float v : gains) {
+            g *= lq::from_float(v);
+            want *= v;
+        }
+        expect_near("gain chain", g.to_linear<1, 31>().to_float(), want, 1e-6f);
+    }
+
+    // Ordering follows the linear value
+    {
+        auto a = lq::from_float(-4.0f);
+        auto b = lq::from_float(-0.5f);
+        auto c = lq::zero();
+        auto d = lq::from_float(0.25f);
+        bool ordered = a < b && b < c && c < d && d > a && !(d < d) && d <= d;
+        expect_near("ordering -4 < -0.5 < 0 < 0.25", float(ordered), 1.0f, 0.0f);
+    }
+
+    // Underflow flushes to zero
+    {
+        auto tiny = lq::from_float(1e-12f);
+        expect_near("tiny^4 underflows to zero", float(tiny.pow(4).is_zero()), 1.0f, 0.0f);
+    }
+
+    // Tier selection on the conversions
+    {
+        auto x = lq::from_linear<fp::fast>(q31::from_float(0.7f));
+        expect_near("fast from_linear(0.7)", x.to_linear<1, 31, fp::fast>().to_float(), 0.7f, 2e-3f);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_log_fixed_tests();
+    return 0;
+}
+#endif
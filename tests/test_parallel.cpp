@@ -0,0 +1,132 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+namespace fp {
+namespace test {
+
+// Every parallel reduction equals the serial one bit for bit
+template<int I, int F>
+static void check_parallel(const FixedPointArray<I, F, fp::test::Backend>& x,
+                           const FixedPointArray<I, F, fp::test::Backend>& y,
+                           const parallel_policy& policy, const char* policy_name)
+{
+    auto a = x.stats(policy);
+    auto b = x.stats();
+    int bad_stats = 0;
+    bad_stats += (a.min.raw() != b.min.raw()) + (a.max.raw() != b.max.raw());
+    bad_stats += (a.sum.raw() != b.sum.raw()) + (a.mean.raw() != b.mean.raw());
+    bad_stats += (a.power.raw() != b.power.raw()) + (a.rms.raw() != b.rms.raw());
+    bad_stats += (a.variance.raw() != b.variance.raw()) + (a.stddev.raw() != b.stddev.raw());
+    expect_exact(bad_stats, "par stats Q%d.%d (%s)", I, F, policy_name);
+    expect_exact(x.sum(policy).raw() != x.sum().raw(), "par sum Q%d.%d (%s)", I, F, policy_name);
+    expect_exact(x.mean(policy).raw() != x.mean().raw(), "par mean Q%d.%d (%s)", I, F, policy_name);
+    expect_exact(x.power(policy).raw() != x.power().raw(), "par power Q%d.%d (%s)", I, F, policy_name);
+    expect_exact(x.rms(policy).raw() != x.rms().raw(), "par rms Q%d.%d (%s)", I, F, policy_name);
+    expect_exact(x.variance(policy).raw() != x.variance().raw(), "par variance Q%d.%d (%s)", I, F, policy_name);
+    expect_exact(x.stddev(policy).raw() != x.stddev().raw(), "par stddev Q%d.%d (%s)", I, F, policy_name);
+    expect_exact(x.dot_product(y, policy).raw() != x.dot_product(y).raw(),
+                 "par dot_product Q%d.%d (%s)", I, F, policy_name);
+}
+
+void run_parallel_tests() {
+    std::puts("\n--- Parallel Execution Policy Tests ---");
+
+    constexpr size_t N = 100003;   // odd length: a short last chunk
+
+    FixedVector<1, 15, fp::test::Backend> a16(N), b16(N);
+    FixedVector<8, 23, fp::test::Backend> a32(N), b32(N);
+    Lcg rng(12345);
+    for (size_t i = 0; i < N; ++i) {
+        a16.data()[i] = rng.raw<int16_t>();
+        b16.data()[i] = rng.raw<int16_t>();
+        a32.data()[i] = rng.raw<int32_t>();
+        b32.data()[i] = rng.raw<int32_t>();
+    }
+
+    ThreadPool pool3(3), pool1(1);
+    const parallel_policy policies[] = {
+        fp::par,                                // default pool, 64 KiB chunks
+        parallel_policy{&pool3, 8 * 1024},      // many small chunks, work stealing
+        parallel_policy{&pool1},                // single participant: serial path
+    };
+    const char* const policy_names[] = { "default pool", "3 threads, 8 KiB chunks", "1 thread" };
+
+    // Reductions: 16-bit (64-bit accumulator) and 32-bit (split accumulator,
+    // sums of squares far beyond 2^64)
+    {
+        for (size_t k = 0; k < sizeof(policies) / sizeof(policies[0]); ++k) {
+            check_parallel<1, 15>(a16, b16, policies[k], policy_names[k]);
+            check_parallel<8, 23>(a32, b32, policies[k], policy_names[k]);
+        }
+
+        int bad = (a32.dot_product(b32, fp::seq).raw() != a32.dot_product(b32).raw());
+        bad += (a16.stats(fp::seq).rms.raw() != a16.stats().rms.raw());
+        expect_near("seq overloads == plain calls", float(bad), 0.0f, 0.0f);
+    }
+
+    // Repeated runs on the default pool: scheduling never changes the result
+    {
+        auto first = a32.stats(fp::par);
+        int bad = 0;
+        for (int r = 0; r < 8; ++r) {
+            auto again = a32.stats(fp::par);
+            bad += (again.variance.raw() != first.variance.raw()) + (again.power.raw() != first.power.raw());
+        }
+        expect_near("par stats deterministic across runs", float(bad), 0.0f, 0.0f);
+    }
+
+    // Element-wise ops: every chunk runs the serial kernel
+    {
+        FixedVector<8, 23, fp::test::Backend> serial(N), parallel(N);
+        auto mismatches = [&]() {
+            int bad = 0;
+            for (size_t i = 0; i < N; ++i) bad += (serial.data()[i] != parallel.data()[i]);
+            return bad;
+        };
+        for (size_t k = 0; k < sizeof(policies) / sizeof(policies[0]); ++k) {
+            a32.elemult(b32, serial);
+            a32.elemult(b32, parallel, policies[k]);
+            expect_exact(mismatches(), "par elemult Q8.23 (%s)", policy_names[k]);
+            a32.add(b32, serial);
+            a32.add(b32, parallel, policies[k]);
+            expect_exact(mismatches(), "par add Q8.23 (%s)", policy_names[k]);
+            a32.sub(b32, serial);
+            a32.sub(b32, parallel, policies[k]);
+            expect_exact(mismatches(), "par sub Q8.23 (%s)", policy_names[k]);
+        }
+    }
+
+    // Small arrays stay on the calling thread with the same results
+    {
+        q_array<1, 15, fp::test::Backend> x(a16.data(), 100), y(b16.data(), 100);
+        check_parallel<1, 15>(x, y, fp::par, "100 elements");
+        q_array<1, 15, fp::test::Backend> empty(a16.data(), 0);
+        int bad = (empty.dot_product(empty, fp::par).raw() != 0) + (empty.stats(fp::par).max.raw() != 0);
+        expect_near("par on an empty array", float(bad), 0.0f, 0.0f);
+    }
+
+    // Pool: every index runs exactly once, including repeated jobs
+    {
+        std::vector<int> hits(1000, 0);
+        for (int r = 0; r < 20; ++r) {
+            pool3.parallel_for(hits.size(), [&](size_t i) { ++hits[i]; });
+        }
+        int bad = 0;
+        for (int h : hits) bad += (h != 20);
+        expect_near("ThreadPool::parallel_for covers each index once", float(bad), 0.0f, 0.0f);
+        expect_near("ThreadPool size", float(pool3.size()), FP_HAS_THREADS ? 3.0f : 1.0f, 0.0f);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_parallel_tests();
+    return 0;
+}
+#endif
@@ -0,0 +1,88 @@
+#include "test_common.hpp"
+#include <climits>
+#include <cstdio>
+#include <vector>
+
+namespace fp {
+namespace test {
+
+// round_shift is the rounding step behind every narrowing shift (scalar
+// multiply/convert, fp::as, fp::convert): round to nearest, ties away from
+// zero, the same result for x and -x
+void run_rounding_tests() {
+    using q16 = q<1, 15, fp::test::Backend>;
+
+    std::puts("\n--- Rounding Tests ---");
+
+    // Exact negative multiples divide exactly; negative ties go away from zero
+    {
+        struct Case { long long x; int s; long long want; };
+        const Case cases[] = {
+            { -2, 1, -1 }, { -4, 3, -1 }, { -64, 4, -4 }, { -6, 2, -2 },   // exact / tie
+            { -3, 1, -2 }, { -5, 2, -1 }, { -7, 2, -2 }, { -1, 3, 0 },     // ties / below half
+            {  3, 1,  2 }, {  5, 2,  1 }, {  7, 2,  2 }, {  2, 1, 1 },     // positive mirror
+        };
+        char name[64];
+        for (const Case& c : cases) {
+            std::snprintf(name, sizeof(name), "round_shift(%lld, %d)", c.x, c.s);
+            expect_near(name, float(round_shift(c.x, c.s)), float(c.want), 0.0f);
+        }
+    }
+
+    // Symmetric about zero over a sweep
+    {
+        int bad = 0;
+        for (long long x = -300; x <= 300; ++x)
+            for (int s = 1; s < 6; ++s) bad += (round_shift(x, s) != -round_shift(-x, s));
+        expect_near("round_shift(x, s) == -round_shift(-x, s)", float(bad), 0.0f, 0.0f);
+    }
+
+    // No negation, so the bottom of the range does not overflow
+    expect_near("round_shift(LLONG_MIN, 1)", float(round_shift(LLONG_MIN, 1) == LLONG_MIN / 2), 1.0f, 0.0f);
+    expect_near("round_shift(LLONG_MIN, 63)", float(round_shift(LLONG_MIN, 63)), -1.0f, 0.0f);
+    expect_near("round_shift(LLONG_MIN + 1, 62)", float(round_shift(LLONG_MIN + 1, 62)), -2.0f, 0.0f);
+
+    // Non-positive shifts pass through / scale up
+    expect_near("round_shift(-5, 0)", float(round_shift(-5, 0)), -5.0f, 0.0f);
+    expect_near("round_shift(-5, -2)", float(round_shift(-5, -2)), -20.0f, 0.0f);
+
+    // Scalar multiply: -1 LSB * 0.5 is a tie and rounds away from zero
+    {
+        auto c = q16(int16_t(-1)) * q16(int16_t(16384));
+        expect_near("mul negative tie rounds away from zero", float(c.raw()), -1.0f, 0.0f);
+    }
+
+    // Scalar multiply: an exact negative product keeps its value
+    {
+        auto c = fp::mul_as<3, 10>(q16::from_float(-0.5f), q16::from_float(0.5f));
+        expect_near("mul_as exact negative product", float(c.raw()), -256.0f, 0.0f);
+    }
+
+    // fp::convert narrows negative values the same way as their mirror
+    {
+        const int16_t src[] = { -256, -384, -128, -1, -129, 256, 384, 128, 1, 129 };
+        const int8_t want[] = { -1, -2, -1, 0, -1, 1, 2, 1, 0, 1 };
+        constexpr size_t n = sizeof(src) / sizeof(src[0]);
+        std::vector<int16_t> in(src, src + n);
+        std::vector<int8_t> out(n);
+        FixedPointArray<1, 15, Backend> X(in.data(), n);
+        FixedPointArray<1, 7, Backend> Y(out.data(), n);
+        fp::convert(X, Y);
+        char name[64];
+        for (size_t i = 0; i < n; ++i) {
+            std::snprintf(name, sizeof(name), "convert Q1.15 %d -> Q1.7", int(src[i]));
+            expect_near(name, float(out[i]), float(want[i]), 0.0f);
+        }
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_rounding_tests();
+    return 0;
+}
+#endif
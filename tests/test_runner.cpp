@@ -5,6 +5,7 @@
 namespace fp {
 namespace test {
     void run_multiply_tests();
+    void run_rounding_tests();
     void run_divide_tests();
     void run_logarithm_tests();
     void run_antilogarithm_tests();
@@ -12,6 +13,15 @@ namespace test {
     void run_power_tests();
     void run_array_ops_tests();
     void run_vector_ops_tests();
+    void run_accuracy_tests();
+    void run_log_fixed_tests();
+    void run_activation_tests();
+    void run_vector_math_tests();
+    void run_array_expr_tests();
+    void run_sliding_window_tests();
+    void run_fixed_vector_tests();
+    void run_strided_tests();
+    void run_parallel_tests();
 }
 }
 
@@ -22,6 +32,7 @@ int main() {
 
     // Run all test suites
     fp::test::run_multiply_tests();
+    fp::test::run_rounding_tests();
     fp::test::run_divide_tests();
     fp::test::run_logarithm_tests();
     fp::test::run_antilogarithm_tests();
@@ -29,6 +40,15 @@ int main() {
     fp::test::run_power_tests();
     fp::test::run_array_ops_tests();
     fp::test::run_vector_ops_tests();
+    fp::test::run_accuracy_tests();
+    fp::test::run_log_fixed_tests();
+    fp::test::run_activation_tests();
+    fp::test::run_vector_math_tests();
+    fp::test::run_array_expr_tests();
+    fp::test::run_sliding_window_tests();
+    fp::test::run_fixed_vector_tests();
+    fp::test::run_strided_tests();
+    fp::test::run_parallel_tests();
 
     // Summary
     std::puts("\n===============================================");
@@ -0,0 +1,181 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace fp {
+namespace test {
+
+// Per-statistic mismatches against a fresh stats() pass, summed over a run
+struct WindowMismatches {
+    int sum = 0, mean = 0, power = 0, rms = 0, variance = 0, stddev = 0, min = 0, max = 0;
+
+    void expect_none(const char* window) const {
+        expect_exact(sum, "%s: sum == stats()", window);
+        expect_exact(mean, "%s: mean == stats()", window);
+        expect_exact(power, "%s: power == stats()", window);
+        expect_exact(rms, "%s: rms == stats()", window);
+        expect_exact(variance, "%s: variance == stats()", window);
+        expect_exact(stddev, "%s: stddev == stats()", window);
+        expect_exact(min, "%s: min == stats()", window);
+        expect_exact(max, "%s: max == stats()", window);
+    }
+};
+
+// Compare every running statistic against a fresh stats() pass over the
+// samples currently in the window
+template<int I, int F, size_t N, typename Window, typename S>
+static void count_window_mismatches(const Window& w, const S* history, size_t pushed, WindowMismatches& bad)
+{
+    size_t n = pushed < N ? pushed : N;
+    FixedPointArray<I, F, fp::test::Backend> tail(const_cast<S*>(history + pushed - n), n);
+    auto ref = tail.stats();
+
+    bad.sum += (w.sum().raw() != ref.sum.raw());
+    bad.mean += (w.mean().raw() != ref.mean.raw());
+    bad.power += (w.power().raw() != ref.power.raw());
+    bad.rms += (w.rms().raw() != ref.rms.raw());
+    bad.variance += (w.variance().raw() != ref.variance.raw());
+    bad.stddev += (w.stddev().raw() != ref.stddev.raw());
+    bad.min += (w.min().raw() != ref.min.raw());
+    bad.max += (w.max().raw() != ref.max.raw());
+}
+
+void run_sliding_window_tests() {
+    using q26 = q<5, 26, fp::test::Backend>;
+    using q15 = q<1, 15, fp::test::Backend>;
+
+    std::puts("\n--- Sliding Window Stats Tests ---");
+
+    // Q5.26 energies, 64-sample window: every step matches a full recompute
+    {
+        constexpr size_t N = 64, STEPS = 300;
+        int32_t history[STEPS];
+        SlidingWindowStats<5, 26, N, true, fp::test::Backend> w;
+
+        WindowMismatches bad;
+        for (size_t i = 0; i < STEPS; ++i) {
+            float e = 0.5f + 0.45f * std::sin(0.07f * float(i)) * std::cos(0.013f * float(i * i % 97));
+            history[i] = q26::from_float(e).raw();
+            w.push(q26(history[i]));
+            count_window_mismatches<5, 26, N>(w, history, i + 1, bad);
+        }
+        bad.expect_none("Q5.26 window of 64, each step");
+        expect_near("window full after 300 pushes", float(w.full()), 1.0f, 0.0f);
+    }
+
+    // Q1.15, short window with plateaus (ties in the min/max deques)
+    {
+        constexpr size_t N = 5, STEPS = 60;
+        int16_t history[STEPS];
+        SlidingWindowStats<1, 15, N, true, fp::test::Backend> w;
+
+        WindowMismatches bad;
+        for (size_t i = 0; i < STEPS; ++i) {
+            history[i] = static_cast<int16_t>(((i * 7919) % 13) * 2500 - 15000);
+            if (i % 9 < 3) history[i] = 4000;
+            w.push_raw(history[i]);
+            count_window_mismatches<1, 15, N>(w, history, i + 1, bad);
+        }
+        bad.expect_none("Q1.15 window of 5, each step");
+    }
+
+    // Block updates: short blocks stream through, long blocks keep their tail
+    {
+        constexpr size_t N = 16;
+        int32_t data[100];
+        for (size_t i = 0; i < 100; ++i) data[i] = q26::from_float(0.01f * float(i) - 0.3f).raw();
+
+        SlidingWindowStats<5, 26, N, true, fp::test::Backend> a, b;
+        for (size_t i = 0; i < 100; ++i) a.push_raw(data[i]);
+        b.push_block(data, 7);
+        b.push_block(data + 7, 3);
+        b.push_block(FixedPointArray<5, 26, fp::test::Backend>(data + 10, 90));
+
+        WindowMismatches bad;
+        count_window_mismatches<5, 26, N>(b, data, 100, bad);
+        bad.expect_none("Q5.26 window after push_block");
+        int diff = (a.mean().raw() != b.mean().raw()) + (a.min().raw() != b.min().raw());
+        expect_near("push_block == per-sample push", float(diff), 0.0f, 0.0f);
+    }
+
+    // reset() fills the window: mean over the full length, like a zeroed buffer
+    {
+        SlidingWindowStats<1, 15, 8, false, fp::test::Backend> w;
+        w.reset();
+        w.push(q15::from_float(0.5f));
+        w.push(q15::from_float(0.25f));
+        expect_near("mean over zero-filled window of 8", w.mean().to_float(), 0.75f / 8.0f, 0.0f);
+        expect_near("power over zero-filled window", w.power().to_float(), 0.3125f, 0.0f);
+        expect_near("back() is the newest sample", w.back().to_float(), 0.25f, 0.0f);
+
+        w.clear();
+        expect_near("cleared window is empty", float(w.empty()), 1.0f, 0.0f);
+        expect_near("mean of empty window", w.mean().to_float(), 0.0f, 0.0f);
+    }
+
+    // Long runs keep the wide square accumulator exact (Q1.31 near full scale)
+    {
+        using q31 = q<1, 31, fp::test::Backend>;
+        SlidingWindowStats<1, 31, 4, false, fp::test::Backend> w;
+        for (int i = 0; i < 100000; ++i) {
+            w.push(q31::from_float((i & 1) ? -0.999f : 0.999f));
+        }
+        w.push(q31::from_float(0.5f));
+        double want = std::sqrt((3 * 0.999 * 0.999 + 0.25) / 4.0);
+        expect_near("rms after 100000 full-scale pushes", w.rms().to_float(), float(want), 1e-6f);
+    }
+
+    // RingBuffer: the view always equals a delay line rolled with memmove,
+    // across several wraps of the write position
+    {
+        constexpr size_t N = 16;
+        using Line = RingBuffer<1, 15, N, fp::test::Backend>;
+        static_assert(std::is_same_v<decltype(std::declval<Line&>().view()), const Line::View>,
+                      "the delay line view is read-only");
+        Line line;
+        int16_t rolled[N] = {}, taps[N];
+        for (size_t k = 0; k < N; ++k) taps[k] = static_cast<int16_t>(1000 * int(k) - 7000);
+        q_array<1, 15, fp::test::Backend> h(taps, N), ref(rolled, N);
+
+        int bad = 0;
+        for (int n = 0; n < 5 * int(N) + 3; ++n) {
+            int16_t x = static_cast<int16_t>((n * 2749) % 30011 - 15000);
+            std::memmove(rolled + 1, rolled, (N - 1) * sizeof(int16_t));
+            rolled[0] = x;
+            line.push(q15(x));
+
+            bad += (std::memcmp(line.data(), rolled, sizeof(rolled)) != 0);
+            bad += (line.view().dot_product(h).raw() != ref.dot_product(h).raw());
+            bad += (line.front().raw() != rolled[0]) + (line.back().raw() != rolled[N - 1]);
+            bad += (line[5].raw() != rolled[5]);
+        }
+        expect_near("RingBuffer view == memmove delay line", float(bad), 0.0f, 0.0f);
+    }
+
+    {
+        RingBuffer<5, 26, 4, fp::test::Backend> line;
+        expect_near("RingBuffer starts zeroed", float(line.view().sum().raw()), 0.0f, 0.0f);
+
+        int32_t block[6] = {1, 2, 3, 4, 5, 6};
+        line.push_block(q_array<5, 26, fp::test::Backend>(block, 6));
+        int bad = (line[0].raw() != 6) + (line[1].raw() != 5) + (line[3].raw() != 3);
+        expect_near("RingBuffer push_block keeps the last N, newest first", float(bad), 0.0f, 0.0f);
+
+        line.reset(q26::from_float(0.5f));
+        expect_near("RingBuffer reset(value)", line.view().mean().to_float(), 0.5f, 0.0f);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_sliding_window_tests();
+    return 0;
+}
+#endif
@@ -115,6 +115,88 @@ void run_sqrt_tests() {
         const float lsb = 1.0f / static_cast<float>(1u << 15);
         expect_near("Reference sqrt(0.5)", got, want, 2.0f * lsb);
     }
+
+    // Integer kernel is correctly rounded: sweep every non-negative Q1.15 input
+    {
+        const float lsb = 1.0f / static_cast<float>(1u << 15);
+        float max_err = 0.0f;
+        for (int raw = 0; raw <= 32767; ++raw) {
+            auto x = q16(static_cast<int16_t>(raw));
+            float want = std::sqrt(static_cast<float>(raw) * lsb);
+            max_err = std::fmax(max_err, std::fabs(x.sqrt().to_float() - want));
+        }
+        expect_near("sqrt Q1.15 sweep max |err| <= 0.5 LSB", max_err, 0.0f, 0.5f * lsb + 1e-7f);
+    }
+
+    std::puts("\n--- Reciprocal Square Root Tests ---");
+
+    {
+        using q8_8 = q<8, 8, fp::test::Backend>;
+        auto x = q8_8::from_float(4.0f);
+        expect_near("rsqrt(4.0) Q8.8", x.rsqrt().to_float(), 0.5f, 1.0f / 256.0f);
+    }
+
+    {
+        using q4_12 = q<4, 12, fp::test::Backend>;
+        auto x = q4_12::from_float(0.3f);
+        float want = 1.0f / std::sqrt(x.to_float());
+        expect_near("rsqrt(0.3) Q4.12", x.rsqrt().to_float(), want, 1.0f / 4096.0f);
+    }
+
+    {
+        auto x = q32::from_float(0.5f);
+        float want = 1.0f / std::sqrt(0.5f);
+        const float lsb = 1.0f / static_cast<float>(1u << 29);
+        expect_near("rsqrt(0.5) Q3.29", x.rsqrt().to_float(), want, 4.0f * lsb);
+    }
+
+    {
+        auto x = q16::from_float(0.0f);
+        expect_near("rsqrt(0.0) error handling", x.rsqrt().to_float(), -1.0f, 0.01f);
+    }
+
+    std::puts("\n--- Array / Wide Square Root Tests ---");
+
+    {
+        int32_t in_data[] = {
+            q32::from_float(0.25f).raw(),
+            q32::from_float(1.0f).raw(),
+            q32::from_float(3.0f).raw(),
+            q32::from_float(0.01f).raw()
+        };
+        int32_t out_data[4];
+        fp::q_array<3, 29, fp::test::Backend> in(in_data, 4);
+        fp::q_array<3, 29, fp::test::Backend> out(out_data, 4);
+        in.sqrt(out);
+
+        const float lsb = 1.0f / static_cast<float>(1u << 29);
+        expect_near("array sqrt [0]: sqrt(0.25)", out[0].to_float(), 0.5f, 2.0f * lsb);
+        expect_near("array sqrt [1]: sqrt(1.0)", out[1].to_float(), 1.0f, 2.0f * lsb);
+        expect_near("array sqrt [2]: sqrt(3.0)", out[2].to_float(), std::sqrt(3.0f), 2.0f * lsb);
+        expect_near("array sqrt [3]: sqrt(0.01)", out[3].to_float(), 0.1f, 2.0f * lsb);
+
+        in.rsqrt(out);
+        expect_near("array rsqrt [0]: 1/sqrt(0.25)", out[0].to_float(), 2.0f, 4.0f * lsb);
+        expect_near("array rsqrt [2]: 1/sqrt(3.0)", out[2].to_float(), 1.0f / std::sqrt(3.0f), 4.0f * lsb);
+    }
+
+    // 64-bit accumulator in Q30 (sum of Q1.15 squares) straight to Q1.15
+    {
+        int64_t acc = 0;
+        const int16_t sample = q16::from_float(0.5f).raw();
+        for (int i = 0; i < 4; ++i) {
+            acc += static_cast<int64_t>(sample) * sample;
+        }
+        auto r = fp::sqrt64<1, 15, fp::test::Backend>(acc / 4, 30);
+        expect_near("sqrt64 Q30 mean square -> Q1.15", r.to_float(), 0.5f, 1.0f / 32768.0f);
+    }
+
+    // Q63 -> Q31 like scl_sqrt64x32
+    {
+        int64_t x = static_cast<int64_t>(1) << 61;  // 0.25 in Q63
+        auto r = fp::sqrt64<1, 31, fp::test::Backend>(x, 63);
+        expect_near("sqrt64 Q63 0.25 -> Q1.31", r.to_float(), 0.5f, 1e-9f);
+    }
 }
 
 } // namespace test
@@ -0,0 +1,323 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace fp {
+namespace test {
+
+// Every reduction on a strided view equals the same reduction on a
+// contiguous copy of its elements
+template<int I, int F, typename S>
+static void check_strided(S* data, size_t length, ptrdiff_t stride)
+{
+    StridedArray<I, F, fp::test::Backend> view(data, length, stride);
+    S copy[256];
+    FixedPointArray<I, F, fp::test::Backend> flat(copy, length);
+    view.gather(flat);
+
+    auto a = view.stats();
+    auto b = flat.stats();
+    const int st = int(stride);
+    int bad_stats = 0;
+    bad_stats += (a.min.raw() != b.min.raw()) + (a.max.raw() != b.max.raw());
+    bad_stats += (a.sum.raw() != b.sum.raw()) + (a.mean.raw() != b.mean.raw());
+    bad_stats += (a.power.raw() != b.power.raw()) + (a.rms.raw() != b.rms.raw());
+    bad_stats += (a.variance.raw() != b.variance.raw()) + (a.stddev.raw() != b.stddev.raw());
+    expect_exact(bad_stats, "strided stats Q%d.%d, stride %d", I, F, st);
+    expect_exact((view.mean().raw() != flat.mean().raw()) + (view.rms().raw() != flat.rms().raw()),
+                 "strided mean / rms Q%d.%d, stride %d", I, F, st);
+    expect_exact((view.argmax().index != flat.argmax().index) + (view.argmin().index != flat.argmin().index),
+                 "strided argmax / argmin Q%d.%d, stride %d", I, F, st);
+    expect_exact(view.dot_product(view).raw() != flat.dot_product(flat).raw(),
+                 "strided dot_product Q%d.%d, stride %d", I, F, st);
+}
+
+// Unsigned 128-bit magnitude as two 64-bit words, for exact sums of 32x32
+// products (twelve of them already pass 2^63)
+struct Wide {
+    uint64_t hi = 0, lo = 0;
+
+    void add(uint64_t m) { lo += m; hi += (lo < m); }
+    bool operator<(const Wide& o) const { return hi < o.hi || (hi == o.hi && lo < o.lo); }
+    Wide operator-(const Wide& o) const { return Wide{hi - o.hi - (lo < o.lo), lo - o.lo}; }
+};
+
+// sum(a[j * ld] * b[j * ld]) computed exactly, rounded half away from zero
+// by frac_bits and saturated to S
+template<typename S>
+static S exact_dot(const S* a, const S* b, size_t length, size_t ld, int frac_bits)
+{
+    Wide pos, neg;
+    for (size_t j = 0; j < length; ++j) {
+        int64_t p = int64_t(a[j * ld]) * int64_t(b[j * ld]);
+        if (p < 0) neg.add(uint64_t(0) - uint64_t(p));
+        else pos.add(uint64_t(p));
+    }
+    const bool negative = pos < neg;
+    Wide mag = negative ? neg - pos : pos - neg;
+    uint64_t q = mag.lo, q_hi = mag.hi;
+    if (frac_bits > 0) {
+        mag.add(uint64_t(1) << (frac_bits - 1));
+        q = (mag.lo >> frac_bits) | (mag.hi << (64 - frac_bits));
+        q_hi = mag.hi >> frac_bits;
+    }
+    const uint64_t limit = uint64_t(std::numeric_limits<S>::max()) + (negative ? 1 : 0);
+    if (q_hi != 0 || q > limit) q = limit;
+    return negative ? static_cast<S>(-static_cast<int64_t>(q)) : static_cast<S>(q);
+}
+
+// Batch results against independent references: dot / power against the
+// exact sum rounded once, norm against round(sqrt(exact sum of squares)),
+// axpy against y + mu * x on FixedPoint (padding columns untouched)
+template<int I, int F>
+static void check_batch(size_t count, size_t length, size_t ld, uint32_t seed, int64_t range)
+{
+    using S = Storage_t<I + F>;
+    using Q = FixedPoint<I, F, fp::test::Backend>;
+    std::vector<S> a(length * ld), b(length * ld), alpha(count), out(count);
+    Lcg rng(seed);
+    auto next = [&]() { return static_cast<S>(static_cast<int64_t>(rng.next() >> 8) % (2 * range + 1) - range); };
+    for (auto& v : a) v = next();
+    for (auto& v : b) v = next();
+    for (auto& v : alpha) v = next();
+
+    BatchView<I, F, fp::test::Backend> A(a.data(), count, length, ld), B(b.data(), count, length, ld);
+    FixedPointArray<I, F, fp::test::Backend> res(out.data(), count), mu(alpha.data(), count);
+    int bad = 0;
+
+    A.dot(B, res);
+    for (size_t k = 0; k < count; ++k) bad += (out[k] != exact_dot(&a[k], &b[k], length, ld, F));
+    expect_exact(bad, "batch dot Q%d.%d, %zu vectors of %zu", I, F, count, length);
+
+    A.power(res);
+    bad = 0;
+    for (size_t k = 0; k < count; ++k) bad += (out[k] != exact_dot(&a[k], &a[k], length, ld, F));
+    expect_exact(bad, "batch power Q%d.%d, %zu vectors of %zu", I, F, count, length);
+
+    A.norm(res);
+    bad = 0;
+    for (size_t k = 0; k < count; ++k) {
+        double sum_sq = 0;
+        for (size_t j = 0; j < length; ++j) sum_sq += double(a[j * ld + k]) * a[j * ld + k];
+        bad += (out[k] != sat_cast<S>(std::llround(std::min(std::sqrt(sum_sq), 4e9))));
+    }
+    expect_exact(bad, "batch norm Q%d.%d, %zu vectors of %zu", I, F, count, length);
+
+    std::vector<S> before(a);
+    A.axpy(mu, B);
+    bad = 0;
+    for (size_t j = 0; j < length; ++j)
+        for (size_t k = 0; k < count; ++k)
+            bad += (a[j * ld + k] != (Q(before[j * ld + k]) + Q(alpha[k]) * Q(b[j * ld + k])).raw());
+    for (size_t j = 0; j < length; ++j)
+        for (size_t k = count; k < ld; ++k) bad += (a[j * ld + k] != before[j * ld + k]);
+    expect_exact(bad, "batch axpy Q%d.%d, %zu vectors of %zu", I, F, count, length);
+}
+
+// deinterleave / interleave and the MatrixView AoS <-> SoA convert give the
+// fp::convert values of each channel gathered through a strided view
+template<int I, int F, int OI, int OF>
+static void check_interleave(size_t channels, size_t frames, uint32_t seed)
+{
+    using S = Storage_t<I + F>;
+    using D = Storage_t<OI + OF>;
+    using Be = fp::test::Backend;
+    std::vector<S> pcm(channels * frames), back(channels * frames), chan(frames), rt(frames);
+    std::vector<D> planar(channels * frames), expect(frames);
+    Lcg rng(seed);
+    for (auto& v : pcm) v = rng.raw<S>();
+
+    FixedPointArray<I, F, Be> in(pcm.data(), pcm.size()), out(back.data(), back.size());
+    std::vector<FixedPointArray<OI, OF, Be>> planes;
+    for (size_t c = 0; c < channels; ++c) planes.emplace_back(planar.data() + c * frames, frames);
+    FixedPointArray<I, F, Be> ch(chan.data(), frames), ch_rt(rt.data(), frames);
+    FixedPointArray<OI, OF, Be> ex(expect.data(), frames);
+    int bad_de = 0, bad_in = 0, bad_matrix = 0;
+
+    deinterleave(in, planes.data(), channels);
+    interleave(planes.data(), channels, out);
+    for (size_t c = 0; c < channels; ++c) {
+        StridedArray<I, F, Be>(pcm.data() + c, frames, ptrdiff_t(channels)).gather(ch);
+        convert(ch, ex);
+        convert(ex, ch_rt);
+        for (size_t f = 0; f < frames; ++f) {
+            bad_de += (planar[c * frames + f] != expect[f]);
+            bad_in += (back[f * channels + c] != rt[f]);
+        }
+    }
+    expect_exact(bad_de, "deinterleave Q%d.%d -> Q%d.%d, %zu x %zu", I, F, OI, OF, channels, frames);
+    expect_exact(bad_in, "interleave Q%d.%d -> Q%d.%d, %zu x %zu", OI, OF, I, F, channels, frames);
+
+    // Same through matrix views: padded SoA (ld = frames + 3) and back
+    std::vector<D> soa(channels * (frames + 3), D(0x5a));
+    std::vector<S> aos(channels * frames);
+    auto src = MatrixView<I, F, Be>::row_major(pcm.data(), frames, channels);
+    auto mid = MatrixView<OI, OF, Be>::col_major(soa.data(), frames, channels, frames + 3);
+    convert(src, mid);
+    convert(mid, MatrixView<I, F, Be>::row_major(aos.data(), frames, channels));
+    for (size_t c = 0; c < channels; ++c) {
+        for (size_t f = 0; f < frames; ++f) bad_matrix += (soa[c * (frames + 3) + f] != planar[c * frames + f]);
+        for (size_t f = frames; f < frames + 3; ++f) bad_matrix += (soa[c * (frames + 3) + f] != D(0x5a));
+    }
+    bad_matrix += int(std::mismatch(aos.begin(), aos.end(), back.begin()) != std::make_pair(aos.end(), back.end()));
+    expect_exact(bad_matrix, "matrix AoS <-> SoA Q%d.%d <-> Q%d.%d, %zu x %zu", I, F, OI, OF, channels, frames);
+}
+
+void run_strided_tests() {
+    using q16 = q<1, 15, fp::test::Backend>;
+    using q31 = q<1, 31, fp::test::Backend>;
+
+    std::puts("\n--- Strided / 2-D View Tests ---");
+
+    // Reductions over strides 1, 2, 3, 4 and -1, 16- and 32-bit
+    {
+        int16_t d16[4 * 61];
+        int32_t d32[4 * 61];
+        for (size_t i = 0; i < 4 * 61; ++i) {
+            d16[i] = static_cast<int16_t>((int(i) * 7919) % 4001 - 2000);
+            d32[i] = static_cast<int32_t>(d16[i]) * 40000 + int32_t(i);
+        }
+        const ptrdiff_t strides[] = {1, 2, 3, 4};
+        for (ptrdiff_t s : strides) {
+            check_strided<1, 15>(d16 + 1, 60, s);
+            check_strided<1, 31>(d32 + 1, 60, s);
+        }
+        check_strided<1, 15>(d16 + 60, 61, -1);
+    }
+
+    // Stereo: process each channel of an interleaved buffer in place
+    {
+        constexpr size_t N = 50;
+        int16_t stereo[2 * N];
+        for (size_t i = 0; i < N; ++i) {
+            stereo[2 * i] = q16::from_float(0.01f * float(i) - 0.25f).raw();
+            stereo[2 * i + 1] = 0;
+        }
+        StridedArray<1, 15, fp::test::Backend> left(stereo, N, 2), right(stereo + 1, N, 2);
+
+        right.assign(fp::as<1, 15>(left * q16::from_float(0.5f) + left));
+        int bad = 0;
+        for (size_t i = 0; i < N; ++i) {
+            auto l = q16(stereo[2 * i]);
+            bad += (std::abs(stereo[2 * i + 1] - (l * q16::from_float(0.5f) + l).raw()) > 1);
+        }
+        expect_near("expression from left into right channel", float(bad), 0.0f, 0.0f);
+
+        int16_t ref[N], ref_out[N];
+        FixedPointArray<1, 15, fp::test::Backend> L(ref, N), T(ref_out, N);
+        left.gather(L);
+        L.tanh(T);
+        left.transform(left, [](const auto& in, auto& out) { in.tanh(out); });
+        bad = 0;
+        for (size_t i = 0; i < N; ++i) bad += (stereo[2 * i] != ref_out[i]);
+        expect_near("transform(tanh) in place on a strided channel", float(bad), 0.0f, 0.0f);
+
+        right.fill(q16::from_float(0.125f));
+        bad = 0;
+        for (size_t i = 0; i < N; ++i) bad += (stereo[2 * i + 1] != q16::from_float(0.125f).raw());
+        bad += (left[7].raw() != ref_out[7]);
+        expect_near("fill / operator[] on strided views", float(bad), 0.0f, 0.0f);
+    }
+
+    // Chunked transform across several CHUNK blocks, format-changing output
+    {
+        constexpr size_t N = 150;
+        int32_t in[3 * N], out[N];
+        for (size_t i = 0; i < 3 * N; ++i) in[i] = q31::from_float(0.001f * float(i % 97) + 0.01f).raw();
+        StridedArray<1, 31, fp::test::Backend> x(in, N, 3);
+        StridedArray<6, 25, fp::test::Backend> y(out, N);
+        x.transform(y, [](const auto& a, auto& b) { a.log2(b); });
+        int bad = 0;
+        for (size_t i = 0; i < N; ++i) bad += (out[i] != x[i].log2().raw());
+        expect_near("transform(log2) stride 3 -> contiguous Q6.25", float(bad), 0.0f, 0.0f);
+    }
+
+    // 2-D views: rows, columns, transpose, diagonal, blocks
+    {
+        constexpr size_t R = 6, C = 9;
+        int32_t buf[R * C];
+        for (size_t r = 0; r < R; ++r)
+            for (size_t c = 0; c < C; ++c) buf[r * C + c] = int32_t(r * 1000 + c) << 12;
+
+        auto m = MatrixView<1, 31, fp::test::Backend>::row_major(buf, R, C);
+        int bad = 0;
+        bad += (m(2, 7).raw() != buf[2 * C + 7]) + !m.row(4).is_contiguous();
+        bad += (m.row(4).sum().raw() != (int32_t(4000 * 9 + 36) << 12));
+        bad += (m.col(5).sum().raw() != (int32_t(15000 + 30) << 12));
+        bad += (m.transpose().row(5).sum().raw() != m.col(5).sum().raw());
+        bad += (m.transpose()(3, 1).raw() != m(1, 3).raw());
+        bad += (m.diag().length() != R) + (m.diag()[4].raw() != buf[4 * C + 4]);
+        auto b = m.block(1, 2, 3, 4);
+        bad += (b(2, 3).raw() != buf[3 * C + 5]) + b.is_packed() + !m.is_packed();
+        bad += (m.flat().length() != R * C) + (m.flat().max().raw() != buf[R * C - 1]);
+
+        auto cm = MatrixView<1, 31, fp::test::Backend>::col_major(buf, C, R);
+        bad += (cm.col(2).sum().raw() != m.row(2).sum().raw()) + !cm.is_packed();
+
+        m.col(0).fill(q31::from_float(0.0f));
+        for (size_t r = 0; r < R; ++r) bad += (buf[r * C] != 0);
+        expect_near("matrix rows/cols/transpose/diag/block", float(bad), 0.0f, 0.0f);
+    }
+    // Batched small vectors (transposed layout): tile edges, padded rows,
+    // 16- and 32-bit, saturating dot / power / axpy
+    {
+        const size_t counts[] = {1, 7, 64, 65, 130};
+        for (size_t c : counts) {
+            check_batch<1, 15>(c, 8, c + 3, uint32_t(c), 30000);
+            check_batch<1, 31>(c, 12, c, uint32_t(c) * 7u, 2000000000);
+            check_batch<8, 8>(c, 4, c + 1, uint32_t(c) * 3u, 32767);
+        }
+        // Norms of 32-bit vectors whose sum of squares stays below 2^53
+        check_batch<1, 31>(33, 16, 40, 99u, 1 << 22);
+
+        int16_t buf[4 * 3];
+        for (size_t i = 0; i < 12; ++i) buf[i] = int16_t(i);
+        BatchView<1, 15, fp::test::Backend> v(buf, 3, 4);
+        int bad = 0;
+        bad += (v.vector(2)[3].raw() != buf[3 * 3 + 2]) + (v.row(1)[2].raw() != buf[1 * 3 + 2]);
+        bad += (v.block(1, 2).vector(0)[2].raw() != buf[2 * 3 + 1]) + (v.block(1, 2).count() != 2);
+        bad += (v.matrix()(3, 1).raw() != buf[3 * 3 + 1]) + (v.matrix().col(2).sum().raw() != 2 + 5 + 8 + 11);
+        expect_near("batch vector/row/block/matrix views", float(bad), 0.0f, 0.0f);
+    }
+    // Interleave / deinterleave: fixed strides 2/4/8, generic 3 and grouped
+    // 11 channels, frame counts around INTERLEAVE_TILE, with and without a
+    // format change (rounding, saturation, widening)
+    {
+        const size_t frames[] = {1, 33, 256, 300};
+        for (size_t n : frames) {
+            check_interleave<1, 15, 1, 15>(2, n, 1u);
+            check_interleave<1, 31, 1, 15>(4, n, 2u);
+            check_interleave<1, 15, 1, 31>(8, n, 3u);
+            check_interleave<4, 12, 1, 15>(3, n, 4u);
+            check_interleave<1, 7, 4, 12>(11, n, 5u);
+            check_interleave<8, 24, 2, 14>(17, n, 6u);
+        }
+
+        // MatrixView convert with same orientation and with reversed rows
+        int16_t a[6 * 5], b[6 * 5] = {}, c[6 * 5] = {};
+        for (int i = 0; i < 30; ++i) a[i] = int16_t(i * 1000 - 15000);
+        auto m = MatrixView<1, 15, fp::test::Backend>::row_major(a, 6, 5);
+        convert(m, MatrixView<1, 15, fp::test::Backend>::row_major(b, 6, 5));
+        convert(m, MatrixView<1, 15, fp::test::Backend>(c + 25, 6, 5, -5, 1));
+        int bad = 0;
+        for (int r = 0; r < 6; ++r)
+            for (int k = 0; k < 5; ++k) bad += (b[r * 5 + k] != a[r * 5 + k]) + (c[(5 - r) * 5 + k] != a[r * 5 + k]);
+        expect_near("matrix convert copy / reversed rows", float(bad), 0.0f, 0.0f);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_strided_tests();
+    return 0;
+}
+#endif
@@ -0,0 +1,289 @@
+#include "test_common.hpp"
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace fp {
+namespace test {
+
+// Worst error of fp::poly in output LSB against the exact polynomial of the
+// same (quantized) coefficients, saturated to the output range
+template<int I, int F, int OI, int OF, int CF, int64_t... C>
+static double poly_worst_lsb(size_t count)
+{
+    using S = Storage_t<I + F>;
+    using D = Storage_t<OI + OF>;
+    std::vector<S> x(count);
+    std::vector<D> y(count);
+    const int64_t lo = std::numeric_limits<S>::min(), span = int64_t(std::numeric_limits<S>::max()) - lo;
+    for (size_t i = 0; i < count; ++i) x[i] = static_cast<S>(lo + span * int64_t(i) / int64_t(count - 1));
+    FixedPointArray<I, F, Backend> X(x.data(), count);
+    FixedPointArray<OI, OF, Backend> Y(y.data(), count);
+    poly<CF, C...>(X, Y);
+
+    const long double coef[] = {static_cast<long double>(C)...};
+    double worst = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        long double xv = std::ldexp(static_cast<long double>(x[i]), -F), r = 0.0L;
+        for (size_t k = sizeof...(C); k-- > 0;) r = r * xv + std::ldexp(coef[k], -CF);
+        r = std::ldexp(r, OF);
+        r = std::min<long double>(std::max<long double>(r, std::numeric_limits<D>::min()),
+                                  std::numeric_limits<D>::max());
+        worst = std::max(worst, double(std::fabs(static_cast<long double>(y[i]) - r)));
+    }
+    return worst;
+}
+
+// Allowed worst error of a 32-bit fp::poly in output LSB: the NatureDSP
+// plan's bound where Xtensa takes vec_poly, else the reference kernel's
+// (last stage and output each round once)
+template<int F, int OF, int CF, int64_t... C>
+static float poly_tolerance_lsb()
+{
+#ifdef __XTENSA__
+    using Plan = detail::NdspPolyPlan<F, OF, CF, C...>;
+    if constexpr (Plan::usable) return float(Plan::max_error_lsb);
+#endif
+    return 0.55f;
+}
+
+// Batched reference array logarithms against the scalar kernels, element for
+// element, over the whole storage range (zero and negative inputs included)
+// and a length that ends mid-block
+template<int Xb, typename Acc>
+static void check_batched_logs(const char* tier, int frac_bits)
+{
+    using R = ReferenceBackend;
+    using S = Storage_t<Xb>;
+    constexpr size_t n = 2 * detail::POLY_BLOCK + 13;
+    std::vector<S> x(n);
+    std::vector<int32_t> w(n);
+    const int64_t lo = std::numeric_limits<S>::min(), span = int64_t(std::numeric_limits<S>::max()) - lo;
+    for (size_t i = 0; i < n; ++i) x[i] = static_cast<S>(lo + span * int64_t(i) / int64_t(n - 1));
+    x[n / 2] = 0;
+
+    char name[96];
+    auto report = [&](const char* op, int bad) {
+        std::snprintf(name, sizeof(name), "batched %s == scalar (%s, %d-bit, frac %d)", op, tier, Xb, frac_bits);
+        expect_near(name, float(bad), 0.0f, 0.0f);
+    };
+    int bad = 0;
+
+    R::template array_log2<Xb, Acc>(x.data(), w.data(), n, frac_bits);
+    for (size_t i = 0; i < n; ++i) bad += (w[i] != R::template log2<Xb, Acc>(x[i], frac_bits));
+    report("log2", bad);
+    bad = 0;
+    R::template array_logn<Xb, Acc>(x.data(), w.data(), n, frac_bits);
+    for (size_t i = 0; i < n; ++i) bad += (w[i] != R::template logn<Xb, Acc>(x[i], frac_bits));
+    report("logn", bad);
+    bad = 0;
+    R::template array_log10<Xb, Acc>(x.data(), w.data(), n, frac_bits);
+    for (size_t i = 0; i < n; ++i) bad += (w[i] != R::template log10<Xb, Acc>(x[i], frac_bits));
+    report("log10", bad);
+}
+
+void run_vector_math_tests() {
+    using q15  = q<16, 15, fp::test::Backend>;
+    using q27  = q<5, 27, fp::test::Backend>;
+    using q29  = q<3, 29, fp::test::Backend>;
+    using q412 = q<4, 12, fp::test::Backend>;
+    using q25  = q<6, 25, fp::test::Backend>;
+
+    std::puts("\n--- Vector Math Tests ---");
+
+    // Every array op matches its scalar counterpart element for element
+    {
+        constexpr size_t N = 75;
+        int32_t in[N], out[N];
+        for (size_t i = 0; i < N; ++i) {
+            in[i] = q15::from_float(0.01f + 900.0f * float(i * i) / float(N * N)).raw();
+        }
+        q_array<16, 15, fp::test::Backend> x(in, N), y(out, N);
+        q_array<6, 25, fp::test::Backend> l(out, N);
+
+        int mismatches = 0;
+        x.log2(l);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q15(in[i]).log2().raw());
+        x.logn(l);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q15(in[i]).logn().raw());
+        x.log10<fp::balanced>(l);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q15(in[i]).log10<fp::balanced>().raw());
+        x.sqrt(y);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q15(in[i]).sqrt().raw());
+        x.rsqrt<fp::fast>(y);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q15(in[i]).rsqrt<fp::fast>().raw());
+        expect_near("array log/sqrt == scalar (Q16.15)", float(mismatches), 0.0f, 0.0f);
+    }
+
+    {
+        constexpr size_t N = 70;
+        int32_t in[N], out[N];
+        for (size_t i = 0; i < N; ++i) {
+            in[i] = q25::from_float(-12.0f + 24.0f * float(i) / float(N - 1)).raw();
+        }
+        q_array<6, 25, fp::test::Backend> x(in, N);
+        q_array<16, 15, fp::test::Backend> y(out, N);
+
+        int mismatches = 0;
+        x.antilog2(y);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q25(in[i]).antilog2().raw());
+        x.antilogn(y);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q25(in[i]).antilogn().raw());
+        x.antilog10(y);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q25(in[i]).antilog10().raw());
+        expect_near("array antilog == scalar (Q6.25 -> Q16.15)", float(mismatches), 0.0f, 0.0f);
+    }
+
+    {
+        constexpr size_t N = 81;
+        int32_t in[N], out[N];
+        for (size_t i = 0; i < N; ++i) {
+            in[i] = q27::from_float(-15.0f + 30.0f * float(i) / float(N - 1)).raw();
+        }
+        q_array<5, 27, fp::test::Backend> x(in, N), y(out, N);
+
+        int mismatches = 0;
+        x.sin(y);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q27(in[i]).sin().raw());
+        x.cos<fp::balanced>(y);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q27(in[i]).cos<fp::balanced>().raw());
+        x.atan(y);
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q27(in[i]).atan().raw());
+        expect_near("array sin/cos/atan == scalar (Q5.27)", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // Batched host logarithms: every tier, 8/16/32-bit storage, frac_bits from 0 to 31
+    check_batched_logs<8, fp::fast>("fast", 5);
+    check_batched_logs<16, fp::balanced>("balanced", 12);
+    check_batched_logs<32, fp::precise>("precise", 27);
+    check_batched_logs<32, fp::fast>("fast", 0);
+    check_batched_logs<32, fp::balanced>("balanced", 31);
+
+    // pow with a shared exponent
+    {
+        constexpr size_t N = 33;
+        int32_t in[N], out[N];
+        for (size_t i = 0; i < N; ++i) {
+            in[i] = q29::from_float(0.5f + 1.9f * float(i) / float(N - 1)).raw();
+        }
+        q_array<3, 29, fp::test::Backend> x(in, N), y(out, N);
+        auto e = q29::from_float(1.5f);
+        x.pow(e, y);
+
+        int mismatches = 0;
+        for (size_t i = 0; i < N; ++i) mismatches += (out[i] != q29(in[i]).pow(e).raw());
+        expect_near("array pow(x, 1.5) == scalar (Q3.29)", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // Reciprocal: rounded 1/x, saturating at zero and out of range
+    {
+        int32_t in[6], out[6];
+        float xs[] = {2.0f, -0.125f, 3.0f, 1000.0f, 0.0f, 1e-4f};
+        for (int i = 0; i < 6; ++i) in[i] = q15::from_float(xs[i]).raw();
+        q_array<16, 15, fp::test::Backend> x(in, 6), y(out, 6);
+        x.recip(y);
+
+        const float lsb15 = 1.0f / 32768.0f;
+        expect_near("recip(2)", q15(out[0]).to_float(), 0.5f, lsb15);
+        expect_near("recip(-0.125)", q15(out[1]).to_float(), -8.0f, lsb15);
+        expect_near("recip(3)", q15(out[2]).to_float(), 1.0f / 3.0f, lsb15);
+        expect_near("recip(1000)", q15(out[3]).to_float(), 0.001f, lsb15);
+        expect_near("recip(0) saturates", float(out[4]), float(INT32_MAX), 0.0f);
+        expect_near("recip(tiny) = 1/lsb", q15(out[5]).to_float(), 32768.0f / 3.0f, 1.0f);
+    }
+
+    {
+        int16_t in[4], out[4];
+        float xs[] = {0.5f, -4.0f, 7.0f, -0.001f};
+        for (int i = 0; i < 4; ++i) in[i] = q412::from_float(xs[i]).raw();
+        q_array<4, 12, fp::test::Backend> x(in, 4), y(out, 4);
+        x.recip(y);
+
+        const float lsb12 = 1.0f / 4096.0f;
+        expect_near("recip(0.5) Q4.12", q412(out[0]).to_float(), 2.0f, lsb12);
+        expect_near("recip(-4) Q4.12", q412(out[1]).to_float(), -0.25f, lsb12);
+        expect_near("recip(7) Q4.12", q412(out[2]).to_float(), 1.0f / 7.0f, lsb12);
+        expect_near("recip(-0.001) saturates", float(out[3]), float(INT16_MIN), 0.0f);
+    }
+
+    // Spectral dB conversion: 10*log10(|X|^2) over a 512-bin power spectrum
+    {
+        constexpr size_t N = 512;
+        int32_t power[N], db[N];
+        for (size_t k = 0; k < N; ++k) {
+            float mag = 0.02f + 40.0f * std::exp(-float(k) / 90.0f) *
+                        (1.0f + 0.5f * std::cos(0.1f * float(k)));
+            power[k] = q15::from_float(mag * mag).raw();
+        }
+        q_array<16, 15, fp::test::Backend> p(power, N);
+        q_array<6, 25, fp::test::Backend> l(db, N);
+        p.log10(l);
+
+        float worst = 0.0f;
+        for (size_t k = 0; k < N; ++k) {
+            float got = 10.0f * q25(db[k]).to_float();
+            float want = 10.0f * std::log10(q15(power[k]).to_float());
+            worst = std::max(worst, std::fabs(got - want));
+        }
+        expect_near("512-bin power spectrum to dB", worst, 0.0f, 1e-5f);
+    }
+
+    // Compile-time polynomials: within rounding of the exact polynomial
+    {
+        constexpr int64_t h = poly_coef<30>(1.5), t = poly_coef<30>(-0.5);             // soft clip
+        constexpr int64_t a0 = poly_coef<30>(0.02), a1 = poly_coef<30>(0.97),
+                          a2 = poly_coef<30>(-0.11), a3 = poly_coef<30>(0.05);          // calibration
+        constexpr int64_t e0 = poly_coef<30>(1.0), e2 = poly_coef<30>(1.0 / 2), e3 = poly_coef<30>(1.0 / 6),
+                          e4 = poly_coef<30>(1.0 / 24), e5 = poly_coef<30>(1.0 / 120),
+                          e6 = poly_coef<30>(1.0 / 720), e7 = poly_coef<30>(1.0 / 5040),
+                          e8 = poly_coef<30>(1.0 / 40320);                             // exp(x)
+        expect_near("poly soft clip Q1.15 -> Q1.15", float(poly_worst_lsb<1, 15, 1, 15, 30, 0, h, 0, t>(4001)),
+                    0.0f, 0.51f);
+        expect_near("poly quadratic Q4.12 -> Q8.8",
+                    float(poly_worst_lsb<4, 12, 8, 8, 20, 1 << 20, -(1 << 19), 1 << 18>(3001)), 0.0f, 0.51f);
+        expect_near("poly 1.7 -> Q1.15 (8-bit input)",
+                    float(poly_worst_lsb<1, 7, 1, 15, 14, 1 << 12, 3 << 12>(256)), 0.0f, 0.51f);
+        expect_near("poly constant", float(poly_worst_lsb<1, 15, 1, 15, 8, -96>(17)), 0.0f, 0.0f);
+        expect_near("poly cubic calibration Q1.31 -> Q1.31",
+                    float(poly_worst_lsb<1, 31, 1, 31, 30, a0, a1, a2, a3>(5001)), 0.0f,
+                    poly_tolerance_lsb<31, 31, 30, a0, a1, a2, a3>());
+        expect_near("poly degree-8 exp Q1.31 -> Q4.28",
+                    float(poly_worst_lsb<1, 31, 4, 28, 30, e0, e0, e2, e3, e4, e5, e6, e7, e8>(5001)),
+                    0.0f, poly_tolerance_lsb<31, 28, 30, e0, e0, e2, e3, e4, e5, e6, e7, e8>());
+        expect_near("poly x^2 - 0.5 Q5.27 -> Q1.31 (saturating)",
+                    float(poly_worst_lsb<5, 27, 1, 31, 20, -(1 << 19), 0, 1 << 20>(5001)), 0.0f,
+                    poly_tolerance_lsb<27, 31, 20, -(1 << 19), 0, 1 << 20>());
+
+        // In place and partly overlapping give the out-of-place values (on
+        // Xtensa the NatureDSP kernel allows neither, so these take the
+        // reference kernel: the two differ by at most both bounds)
+        int32_t x[64], y[64], z[65];
+        for (int i = 0; i < 64; ++i) x[i] = z[i + 1] = (i - 32) * (1 << 25);
+        FixedPointArray<1, 31, Backend> X(x, 64), Y(y, 64), Zin(z + 1, 64), Zout(z, 64);
+        poly<30, a0, a1, a2, a3>(X, Y);
+        poly<30, a0, a1, a2, a3>(X, X);
+        poly<30, a0, a1, a2, a3>(Zin, Zout);
+        const int64_t tol = int64_t(poly_tolerance_lsb<31, 31, 30, a0, a1, a2, a3>() + 0.55f);
+        int bad_in_place = 0, bad_overlap = 0;
+        for (int i = 0; i < 64; ++i) {
+            bad_in_place += (std::abs(int64_t(x[i]) - y[i]) > tol);
+            bad_overlap += (std::abs(int64_t(z[i]) - y[i]) > tol);
+        }
+        expect_near("poly in place", float(bad_in_place), 0.0f, 0.0f);
+        expect_near("poly output one element behind x", float(bad_overlap), 0.0f, 0.0f);
+    }
+}
+
+} // namespace test
+} // namespace fp
+
+// Main function for standalone execution (not used when building full test suite)
+#ifndef FP_TEST_SUITE
+int main() {
+    fp::test::run_vector_math_tests();
+    return 0;
+}
+#endif
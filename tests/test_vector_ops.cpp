@@ -1,4 +1,8 @@
 #include "test_common.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 
 namespace fp {
 namespace test {
@@ -266,6 +270,205 @@ void run_vector_ops_tests() {
         const float lsb = 1.0f / static_cast<float>(1u << 15);
         expect_near("dot product [0.5,0.25]·[0.5,0.5]", dot.to_float(), 0.375f, 4.0f * lsb);
     }
+
+    // Reductions accumulate at full precision and round once. dot / power are
+    // exact on every backend; mean / rms are checked on the reference engine
+    // (NatureDSP's vec_mean / vec_rms round their own way)
+    {
+        using q31 = q<1, 31, Backend>;
+        constexpr size_t N = 257;
+        int32_t a[N], b[N];
+        double dot_ref = 0.0, pow_ref = 0.0, sum_ref = 0.0;
+        for (size_t i = 0; i < N; ++i) {
+            a[i] = q31::from_float(0.003f * std::sin(0.37f * float(i)) + 0.0001f).raw();
+            b[i] = q31::from_float(0.9f * std::cos(0.11f * float(i))).raw();
+            dot_ref += double(a[i]) * double(b[i]);
+            pow_ref += double(a[i]) * double(a[i]);
+            sum_ref += double(a[i]);
+        }
+        fp::q_array<1, 31, Backend> A(a, N), Bv(b, N);
+        fp::q_array<1, 31, ReferenceBackend> R(a, N);
+
+        // Per-product rounding would drift by up to N/2 LSB
+        double dot_lsb = double(A.dot_product(Bv).raw()) - dot_ref / 2147483648.0;
+        expect_near("Q1.31 dot, 257 terms (LSB)", float(dot_lsb), 0.0f, 0.5f);
+
+        double pow_lsb = double(A.power().raw()) - pow_ref / 2147483648.0;
+        expect_near("Q1.31 power, 257 terms (LSB)", float(pow_lsb), 0.0f, 0.5f);
+
+        double rms_ref = std::sqrt(pow_ref / N) / 2147483648.0;
+        expect_near("Q1.31 rms, 257 terms", float(R.rms().to_float()), float(rms_ref), 1e-9f);
+
+        double mean_lsb = double(R.mean().raw()) - sum_ref / N;
+        expect_near("Q1.31 mean (LSB)", float(mean_lsb), 0.0f, 0.5f);
+    }
+
+    // 32x32 partial sums beyond 64 bits: 16 products of ~2^59.7, then 16 of
+    // opposite sign, then a small term
+    {
+        using q15 = q<16, 15, Backend>;
+        constexpr size_t N = 33;
+        int32_t a[N], b[N];
+        for (size_t i = 0; i < 32; ++i) {
+            a[i] = q15::from_float(30000.0f).raw();
+            b[i] = q15::from_float(i < 16 ? 30000.0f : -30000.0f).raw();
+        }
+        a[32] = q15::from_float(0.5f).raw();
+        b[32] = q15::from_float(0.5f).raw();
+        fp::q_array<16, 15, Backend> A(a, N), Bv(b, N);
+        expect_near("dot with cancelling 2^64 partial sums", A.dot_product(Bv).to_float(), 0.25f, 0.0f);
+    }
+
+    // Mixed-precision dot product: 32-bit data with 16- and 8-bit taps,
+    // against the exact 64-bit sum rounded once. NatureDSP's 32x16 kernel
+    // truncates the low 15 bits first, so target results may differ by 1 LSB
+    {
+        constexpr size_t N = 1001;
+        std::vector<int32_t> x(N);
+        std::vector<int16_t> h16(N);
+        std::vector<int8_t> h8(N);
+        Lcg rng(45);
+        for (size_t i = 0; i < N; ++i) {
+            x[i] = rng.raw<int32_t>() >> (8 + i % 5);
+            uint32_t u = rng.next();
+            h16[i] = static_cast<int16_t>(u >> 16);
+            h8[i] = static_cast<int8_t>(u >> 24);
+        }
+        long long sum16 = 0, sum8 = 0;
+        for (size_t i = 0; i < N; ++i) {
+            sum16 += static_cast<long long>(x[i]) * h16[i];
+            sum8 += static_cast<long long>(x[i]) * h8[i];
+        }
+        fp::q_array<1, 31, Backend> X(x.data(), N);
+        fp::q_array<1, 15, Backend> H16(h16.data(), N);
+        fp::q_array<1, 7, Backend> H8(h8.data(), N);
+
+        // Differences from the rounded exact sum, in LSB
+        auto lsb = [](int32_t got, long long sum, int shift) {
+            return float(static_cast<long long>(got) - sat_cast<int32_t>(round_shift(sum, shift)));
+        };
+        expect_near("dot 32x16 -> Q1.31 (LSB)", lsb(X.dot_product(H16).raw(), sum16, 15), 0.0f, 1.0f);
+        expect_near("dot 32x16 -> Q8.24 (LSB)", lsb(X.dot_product<8, 24>(H16).raw(), sum16, 22), 0.0f, 1.0f);
+        expect_near("dot 32x8 -> Q1.31 (LSB)", lsb(X.dot_product(H8).raw(), sum8, 7), 0.0f, 0.0f);
+        expect_near("dot 16x32 == 32x16", float(H16.dot_product<1, 31>(X).raw() - X.dot_product(H16).raw()),
+                    0.0f, 0.0f);
+        expect_near("dot<I, F> == same-format dot", float(X.dot_product<1, 31>(X).raw() - X.dot_product(X).raw()),
+                    0.0f, 0.0f);
+    }
+
+    // 150000 products of exactly 1.0 (Q1.31 -1 times Q1.15 -1): the total,
+    // 150000 * 2^46, is past 2^63 and spans several accumulation blocks
+    {
+        constexpr size_t N = 150000;
+        std::vector<int32_t> x(N, INT32_MIN);
+        std::vector<int16_t> h(N, INT16_MIN);
+        fp::q_array<1, 31, Backend> X(x.data(), N);
+        fp::q_array<1, 15, Backend> H(h.data(), N);
+        expect_near("dot 32x16, 150000 terms past 2^63", X.dot_product<20, 12>(H).to_float(), 150000.0f, 0.0f);
+    }
+
+    // Result with more fraction bits than the product: left shift, saturating
+    {
+        int16_t a[] = {q<4, 12>::from_float(1.5f).raw(), q<4, 12>::from_float(-0.25f).raw()};
+        int8_t b[] = {q<1, 7>::from_float(0.75f).raw(), q<1, 7>::from_float(-0.75f).raw()};
+        fp::q_array<4, 12, Backend> A(a, 2);
+        fp::q_array<1, 7, Backend> Bv(b, 2);
+        expect_near("dot Q4.12 x Q1.7 -> Q8.24", A.dot_product<8, 24>(Bv).to_float(), 1.3125f, 0.0f);
+        expect_near("dot Q4.12 x Q1.7 -> Q1.31 saturates", float(A.dot_product<1, 31>(Bv).raw()),
+                    float(INT32_MAX), 0.0f);
+    }
+
+    // Sum and power saturate instead of wrapping
+    {
+        int16_t data[] = {q16::from_float(0.75f).raw(), q16::from_float(0.75f).raw(),
+                          q16::from_float(-0.25f).raw(), q16::from_float(0.75f).raw()};
+        fp::q_array<1, 15, Backend> arr(data, 4);
+        expect_near("sum saturates (Q1.15)", float(arr.sum().raw()), 32767.0f, 0.0f);
+        expect_near("power saturates (Q1.15)", float(arr.power().raw()), 32767.0f, 0.0f);
+
+        fp::q_array<1, 15, Backend> head(data + 1, 2);
+        expect_near("power of [0.75, -0.25]", head.power().to_float(), 0.625f, 0.0f);
+    }
+
+    // Fused stats() agrees with the individual reductions
+    {
+        constexpr size_t N = 203;
+        int16_t data[N];
+        for (size_t i = 0; i < N; ++i) {
+            data[i] = q16::from_float(0.6f * std::sin(0.21f * float(i)) - 0.1f).raw();
+        }
+        fp::q_array<1, 15> arr(data, N);
+        auto st = arr.stats();
+
+        int mismatches = 0;
+        mismatches += (st.min.raw() != arr.min().raw());
+        mismatches += (st.max.raw() != arr.max().raw());
+        mismatches += (st.sum.raw() != arr.sum().raw());
+        mismatches += (st.mean.raw() != arr.mean().raw());
+        mismatches += (st.power.raw() != arr.power().raw());
+        mismatches += (st.rms.raw() != arr.rms().raw());
+        mismatches += (st.variance.raw() != arr.variance().raw());
+        mismatches += (st.stddev.raw() != arr.stddev().raw());
+        expect_near("stats() == individual reductions (Q1.15)", float(mismatches), 0.0f, 0.0f);
+
+        auto part = arr.stats<fp::stat::mean | fp::stat::stddev>();
+        expect_near("stats<mean|stddev> mean", part.mean.to_float(), st.mean.to_float(), 0.0f);
+        expect_near("stats<mean|stddev> stddev", part.stddev.to_float(), st.stddev.to_float(), 0.0f);
+        expect_near("stats<mean|stddev> leaves max at 0", part.max.to_float(), 0.0f, 0.0f);
+    }
+
+    // stats() over every tail length of the reduction lanes (1 .. 2 * lanes + 1)
+    {
+        int16_t data[2 * detail::REDUCE_LANES + 1];
+        int mismatches = 0;
+        for (size_t n = 1; n <= sizeof(data) / sizeof(data[0]); ++n) {
+            long long sum = 0, sum_sq = 0;
+            int16_t lo = INT16_MAX, hi = INT16_MIN;
+            for (size_t i = 0; i < n; ++i) {
+                data[i] = int16_t(int(i * 2654435761u % 4001u) - 2000);
+                sum += data[i];
+                sum_sq += (long long)data[i] * data[i];
+                lo = std::min(lo, data[i]);
+                hi = std::max(hi, data[i]);
+            }
+            auto st = fp::q_array<1, 15>(data, n).stats<fp::stat::min | fp::stat::max | fp::stat::sum |
+                                                        fp::stat::power>();
+            mismatches += (st.min.raw() != lo) + (st.max.raw() != hi) + (st.sum.raw() != sum);
+            mismatches += (st.power.raw() != sat_cast<int16_t>(round_shift(sum_sq, 15)));
+        }
+        expect_near("stats() over every lane tail length", float(mismatches), 0.0f, 0.0f);
+    }
+
+    // Variance has no cancellation error on a large offset (Q16.15)
+    {
+        using q15 = q<16, 15>;
+        constexpr size_t N = 500;
+        int32_t data[N];
+        double sum = 0.0, sum_sq = 0.0;
+        for (size_t i = 0; i < N; ++i) {
+            data[i] = q15::from_float(12000.0f + 0.75f * std::cos(0.05f * float(i))).raw();
+            sum += double(data[i]);
+        }
+        double mean = sum / N;
+        for (size_t i = 0; i < N; ++i) sum_sq += (double(data[i]) - mean) * (double(data[i]) - mean);
+        double var_raw = sum_sq / N / 32768.0;
+
+        fp::q_array<16, 15> arr(data, N);
+        auto st = arr.stats();
+        expect_near("variance around 12000 (LSB)", float(double(st.variance.raw()) - var_raw), 0.0f, 0.5f);
+        expect_near("stddev around 12000", st.stddev.to_float(),
+                    float(std::sqrt(var_raw / 32768.0)), 1.0f / 32768.0f);
+        expect_near("min around 12000", st.min.to_float(), 11999.25f, 1e-3f);
+        expect_near("max around 12000", st.max.to_float(), 12000.75f, 1e-3f);
+    }
+
+    // Mean rounds to nearest (half away from zero)
+    {
+        int16_t data[] = {1, 2, -3, -4};
+        fp::q_array<1, 15, ReferenceBackend> pos(data, 2), neg(data + 2, 2);
+        expect_near("mean of raw [1, 2] = 2", float(pos.mean().raw()), 2.0f, 0.0f);
+        expect_near("mean of raw [-3, -4] = -4", float(neg.mean().raw()), -4.0f, 0.0f);
+    }
 }
 
 } // namespace test